@@ -153,7 +153,14 @@ namespace ADVi3pp {
  *
  * :[2400, 9600, 19200, 38400, 57600, 115200, 250000, 500000, 1000000]
  */
-#define BAUDRATE 115200 // @advi3++
+// @advi3++: 250000 and 500000 are exact with the 16 MHz clock (U2X) while 115200 is 2.1% off.
+// Select them with ADVi3PP_BAUDRATE (custom_baudrate in ini/advi3pp.ini). The host has then to
+// enable XON/XOFF flow control (see SERIAL_XON_XOFF).
+#ifdef ADVi3PP_BAUDRATE
+  #define BAUDRATE ADVi3PP_BAUDRATE
+#else
+  #define BAUDRATE 115200
+#endif
 //#define BAUD_RATE_GCODE     // Enable G-code M575 to set the baud rate
 
 /**
@@ -609,6 +616,13 @@ namespace ADVi3pp {
 #define DUMMY_THERMISTOR_998_VALUE  25
 #define DUMMY_THERMISTOR_999_VALUE 100
 
+// @advi3++: Convert the readings of TEMP_SENSOR_0 and TEMP_SENSOR_BED thermistors with tables resampled at
+// compile time every (1 << THERMISTOR_LUT_SHIFT) raw values (an index and an integer interpolation)
+#define THERMISTOR_LUT
+#if ENABLED(THERMISTOR_LUT)
+  #define THERMISTOR_LUT_SHIFT 6  // 4 ADC counts with 16x oversampling: 257 entries, 514 bytes of flash
+#endif
+
 // Resistor values when using MAX31865 sensors (-5) on TEMP_SENSOR_0 / 1
 #if TEMP_SENSOR_IS_MAX_TC(0)
   #define MAX31865_SENSOR_OHMS_0      100 // (Ω) Typically 100 or 1000 (PT100 or PT1000)
@@ -891,6 +905,7 @@ namespace ADVi3pp {
   //#define SLOW_PWM_HEATERS      // PWM with very low frequency (roughly 0.125Hz=8s) and minimum state time of approximately 1s useful for heaters driven by a relay
   #define PID_FUNCTIONAL_RANGE 10 // If the temperature difference between the target temperature and the actual temperature
                                   // is more than PID_FUNCTIONAL_RANGE then the PID will be shut off and the heater will be set to min/max.
+  #define PID_FIXED_POINT       // @advi3++: Compute the PID with integers (temperatures in 1/16 °C, gains in fixed point)
 
   //#define PID_EDIT_MENU         // Add PID editing to the "Advanced Settings" menu. (~700 bytes of flash)
   //#define PID_AUTOTUNE_MENU     // Add PID auto-tuning to the "Advanced Settings" menu. (~250 bytes of flash)
@@ -1221,6 +1236,7 @@ namespace ADVi3pp {
 
 // Enable this feature if all enabled endstop pins are interrupt-capable.
 // This will remove the need to poll the interrupt pins, saving many CPU cycles.
+// @advi3++: Not possible with the i3 Plus mainboards, their endstop pins are not interrupt-capable.
 //#define ENDSTOP_INTERRUPTS_FEATURE
 
 /**
@@ -1349,6 +1365,10 @@ namespace ADVi3pp {
   #define JUNCTION_DEVIATION_MM 0.013 // (mm) Distance from real junction edge
   #define JD_HANDLE_SMALL_SEGMENTS    // Use curvature estimation instead of just the junction angle
                                       // for small segments (< 1mm) with large junction angles (> 135°).
+  #define JD_CACHE                    // @advi3++ Cache the junction factors by quantized angle (report with M205 C)
+  #if ENABLED(JD_CACHE)
+    #define JD_CACHE_SIZE 16          // Number of entries (power of 2), 10 bytes of SRAM each
+  #endif
 #endif
 
 /**
@@ -1359,7 +1379,12 @@ namespace ADVi3pp {
  *
  * See https://github.com/synthetos/TinyG/wiki/Jerk-Controlled-Motion-Explained
  */
-//#define S_CURVE_ACCELERATION
+#define S_CURVE_ACCELERATION // @advi3++
+#if ENABLED(S_CURVE_ACCELERATION)
+  // @advi3++ Evaluate the S-curve with a small PROGMEM table and integer math instead of
+  // the Bézier polynomial. Cheaper in the stepper ISR so it can be combined with LIN_ADVANCE.
+  #define S_CURVE_TABLE
+#endif
 
 //===========================================================================
 //============================= Z Probe Options =============================
@@ -1684,6 +1709,13 @@ namespace ADVi3pp {
 #define Z_CLEARANCE_MULTI_PROBE     4 // Z Clearance between multiple probes
 //#define Z_AFTER_PROBING           5 // Z position after probing is done
 
+// @advi3++: Fast G29 for the bilinear leveling (except with G29 E) when the BLTouch is in high speed mode (M401 S1).
+// The probe is kept deployed and the lift between two points is computed from the points already measured around the next one.
+#define G29_FAST_PROBING
+#if ENABLED(G29_FAST_PROBING)
+  #define G29_FAST_CLEARANCE        2 // (mm) Clearance above the highest measured or estimated point, up to Z_CLEARANCE_BETWEEN_PROBES
+#endif
+
 #define Z_PROBE_LOW_POINT          -2 // (mm) Farthest distance below the trigger-point to go before stopping
 
 // For M851 give a range for adjusting the Z probe offset
@@ -2079,6 +2111,14 @@ namespace ADVi3pp {
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
+  /**
+   * @advi3++: With bilinear leveling, split moves at the grid lines and, inside a cell,
+   * only where the mesh is twisted enough for the correction to deviate from a straight
+   * segment by more than the tolerance. Replaces the fixed segments of SEGMENT_LEVELED_MOVES.
+   */
+  #define ADAPTIVE_LEVELED_SEGMENTS
+  #define LEVELED_SEGMENT_TOLERANCE 0.005 // (mm) Maximal Z error of a segment
+
   /**
    * Enable the G26 Mesh Validation Pattern tool.
    */
@@ -2116,11 +2156,23 @@ namespace ADVi3pp {
     // Synthesizes intermediate points to produce a more detailed mesh.
     //
     //#define ABL_BILINEAR_SUBDIVISION
+
+    // @advi3++: Precompute the bilinear surface of each cell with integers (8 bytes of RAM per cell)
+    #define ABL_BILINEAR_COEFFICIENTS
     #if ENABLED(ABL_BILINEAR_SUBDIVISION)
       // Number of subdivisions between probe points
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    // @advi3++: Keep meshes in slots at the end of the EEPROM, with the bed temperature of each.
+    // M424 T C A selects the slot by the bed temperature and checks it at 3 points
+    // instead of probing the whole mesh (G29 is only run when the check fails).
+    #define BILINEAR_MESH_SLOTS 4
+    #ifdef BILINEAR_MESH_SLOTS
+      #define MESH_SLOT_TEMP_RANGE       10   // (°C) Maximal difference with the bed temperature of a slot
+      #define MESH_SLOT_CHECK_TOLERANCE 0.05  // (mm) Maximal difference between the mesh and a probed point
+    #endif
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -2542,6 +2594,13 @@ namespace ADVi3pp {
 #define PRINTCOUNTER
 #if ENABLED(PRINTCOUNTER)
   #define PRINTCOUNTER_SAVE_INTERVAL 60 // (minutes) EEPROM save interval during print. A value of 0 will save stats at end of print.
+
+  // @advi3++: Statistics of the last jobs: time printing, heating and paused, planner starvations,
+  // serial overruns, SD stalls, filament and heater duty. Kept at the end of the EEPROM, shown by M78.
+  #define JOB_STATISTICS
+  #if ENABLED(JOB_STATISTICS)
+    #define JOB_STATISTICS_COUNT 4      // Number of jobs kept (1 to 4)
+  #endif
 #endif
 
 // @section security
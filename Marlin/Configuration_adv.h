@@ -1087,7 +1087,7 @@
  *  Y<1>         Set the given parameters only for the Y axis.
  */
 //#define INPUT_SHAPING_X
-//#define INPUT_SHAPING_Y
+#define INPUT_SHAPING_Y // @advi3++ The heavy Y bed of the i3 Plus is what rings the most
 #if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
   #if ENABLED(INPUT_SHAPING_X)
     #define SHAPING_FREQ_X  40          // (Hz) The default dominant resonant frequency on the X axis.
@@ -1097,8 +1097,10 @@
     #define SHAPING_FREQ_Y  40          // (Hz) The default dominant resonant frequency on the Y axis.
     #define SHAPING_ZETA_Y  0.15f       // Damping ratio of the Y axis (range: 0.0 = no damping to 1.0 = critical damping).
   #endif
-  //#define SHAPING_MIN_FREQ  20        // By default the minimum of the shaping frequencies. Override to affect SRAM usage.
-  //#define SHAPING_MAX_STEPRATE 10000  // By default the maximum total step rate of the shaped axes. Override to affect SRAM usage.
+  // @advi3++ Bound the step queue for the ATmega2560: (10000 / 25 / 2 + 3) * 3 bytes = 609 bytes of SRAM.
+  // Above 125 mm/s on Y, the echoes are emitted early and shaping is less effective.
+  #define SHAPING_MIN_FREQ  25          // By default the minimum of the shaping frequencies. Override to affect SRAM usage.
+  #define SHAPING_MAX_STEPRATE 10000    // By default the maximum total step rate of the shaped axes. Override to affect SRAM usage.
   //#define SHAPING_MENU                // Add a menu to the LCD to set shaping parameters.
 #endif
 
@@ -1558,6 +1560,27 @@
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
+  /**
+   * Read the file being printed with its own sector buffers (512 bytes of SRAM each),
+   * a cache of its cluster chain and multiple block reads, instead of the volume cache
+   * shared with the FAT. With 2 buffers, the next sector is read while the queue is full,
+   * for 512 more bytes of SRAM. @advi3++
+   */
+  #define SD_STREAM
+  #if ENABLED(SD_STREAM)
+    #define SD_STREAM_BUFFERS 1             // 1 or 2 (check the free memory on the Statistics screen first)
+    #define SD_STREAM_RUNS    4             // Runs of contiguous clusters kept in cache
+  #endif
+
+  /**
+   * During binary file transfers (M28 B1), return from a block write as soon as the card has
+   * accepted the data, without waiting for the card to flash it. The flashing is overlapped
+   * with the reception of the next packets. The next command waits for its end and checks
+   * the status (CMD13) of the block. The other writes (file sync, power-loss recovery, M28)
+   * wait for the flashing as usual. @advi3++
+   */
+  #define SD_WRITE_BEHIND
+
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -1588,9 +1611,11 @@
    * an option on the LCD screen to continue the print from the last-known
    * point in the file.
    */
-  //#define POWER_LOSS_RECOVERY
+  #define POWER_LOSS_RECOVERY // @advi3++: Records appended to a journal, cheap enough for AVR
   #if ENABLED(POWER_LOSS_RECOVERY)
-    #define PLR_ENABLED_DEFAULT   false // Power Loss Recovery enabled by default. (Set with 'M413 Sn' & M500)
+    #define PLR_ENABLED_DEFAULT   true  // Power Loss Recovery enabled by default. (Set with 'M413 Sn' & M500)
+    #define POWER_LOSS_JOURNAL_BLOCKS 4 // @advi3++: Blocks of 512 bytes of records in the recovery file
+    #define SAVE_INFO_INTERVAL_MS 60000 // @advi3++: (ms) Also save during long layers
     //#define BACKUP_POWER_SUPPLY       // Backup power / UPS to move the steppers on power loss
     //#define POWER_LOSS_ZRAISE       2 // (mm) Z axis raise on resume (on power loss with UPS)
     //#define POWER_LOSS_PIN         44 // Pin to detect power loss. Set to -1 to disable default pin on boards without module.
@@ -1758,7 +1783,8 @@
   //#define CONFIGURATION_EMBEDDING
 
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
-  //#define BINARY_FILE_TRANSFER
+  // See buildroot/share/scripts/sd_upload.py for the host side. @advi3++
+  #define BINARY_FILE_TRANSFER
 
   #if ENABLED(BINARY_FILE_TRANSFER)
     // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
@@ -2321,6 +2347,28 @@
   #endif
 #endif // PTC_PROBE || PTC_BED || PTC_HOTEND
 
+/**
+ * @advi3++: Bed Temperature Z Compensation
+ *
+ * Move the bilinear mesh with the height of the bed, measured at its center for a few
+ * temperatures. A mesh probed at one bed temperature can then be used for the others.
+ * The offset is the height at the target temperature of the bed minus the height at the
+ * temperature of the mesh (recorded by G29).
+ * Use M870 C to calibrate (heats the bed to each temperature and probes the center).
+ * The calibration is started from the host: the LCD Panel only shows its progress in the
+ * status message.
+ * Use M870 to report or set the values.
+ */
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+  #define BED_TEMP_Z_COMPENSATION
+  #if ENABLED(BED_TEMP_Z_COMPENSATION)
+    #define BED_TEMP_Z_START   50   // (°C)
+    #define BED_TEMP_Z_RES     10   // (°C)
+    #define BED_TEMP_Z_COUNT    7   // 50 to 110 °C
+    #define BED_TEMP_Z_SETTLE  60   // (s) Time for the bed to settle at each temperature
+  #endif
+#endif
+
 // @section extras
 
 //
@@ -2334,9 +2382,11 @@
 #define ARC_SUPPORT                   // Requires ~3226 bytes
 #if ENABLED(ARC_SUPPORT)
   #define MIN_ARC_SEGMENT_MM      0.1 // (mm) Minimum length of each arc segment
-  #define MAX_ARC_SEGMENT_MM      1.0 // (mm) Maximum length of each arc segment
+  #define MAX_ARC_SEGMENT_MM      2.0 // (mm) Maximum length of each arc segment @advi3++
   #define MIN_CIRCLE_SEGMENTS    72   // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50   // Use the feedrate to choose the segment length
+  #define ARC_CHORDAL_TOLERANCE 0.01  // @advi3++ (mm) Use the deviation from the arc, the feedrate and the minimum segment time (M205 B) to choose the segment length
+  #define ARC_INTEGER                 // @advi3++ Rotate the arc radius vector with integers between corrections
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES             // Enable the 'P' parameter to specify complete circles
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
@@ -2447,6 +2497,14 @@
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
 
+// Store the commands back-to-back instead of in BUFSIZE slots of MAX_CMD_SIZE bytes. @advi3++
+// In the BUFSIZE * MAX_CMD_SIZE bytes of the slots, the queue holds 7 lines such as
+// "G1 X112.345 Y98.765 E0.04213" read from SD, 6 lines streamed with N and *, instead of 4.
+#define PACKED_COMMAND_QUEUE
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #define COMMAND_QUEUE_SIZE 384  // (bytes) Replaces BUFSIZE * (MAX_CMD_SIZE + index of GCODE_TOKENIZER)
+#endif
+
 // Transmission to Host Buffer Size
 // To save 386 bytes of flash (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
 // To buffer a simple "ok" you need 4 bytes.
@@ -2461,23 +2519,33 @@
 // To use flow control, set this buffer size to at least 1024 bytes.
 // :[0, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048]
 //#define RX_BUFFER_SIZE 1024
+#if BAUDRATE > 115200
+  #define RX_BUFFER_SIZE 1024 // @advi3++: Not tested on the printer, check the free memory on the Statistics screen
+#endif
 
+// @advi3++: XOFF is sent when 1/8 of the buffer is used. With 1024 bytes, this leaves
+// 896 bytes (18 ms at 500000 baud, 36 ms at 250000 baud) for the host to react.
 #if RX_BUFFER_SIZE >= 1024
   // Enable to have the controller send XON/XOFF control characters to
   // the host to signal the RX buffer is becoming full.
-  //#define SERIAL_XON_XOFF
+  #define SERIAL_XON_XOFF // @advi3++
 #endif
 
 #if ENABLED(SDSUPPORT)
   // Enable this option to collect and display the maximum
   // RX queue usage after transferring a file to SD.
-  //#define SERIAL_STATS_MAX_RX_QUEUED
+  #define SERIAL_STATS_MAX_RX_QUEUED // @advi3++
 
   // Enable this option to collect and display the number
   // of dropped bytes after a file transfer to SD.
-  //#define SERIAL_STATS_DROPPED_RX
+  #define SERIAL_STATS_DROPPED_RX // @advi3++
 #endif
 
+// @advi3++: Count the RX overruns (a byte arrived before the previous one was read) and the
+// framing errors (wrong baud rate). Reported by M111 (M111 R to reset) and in the LCD status message.
+#define SERIAL_STATS_RX_BUFFER_OVERRUNS
+#define SERIAL_STATS_RX_FRAMING_ERRORS
+
 // Monitor RX buffer usage
 // Dump an error to the serial port if the serial receive buffer overflows.
 // If you see these errors, increase the RX_BUFFER_SIZE value.
@@ -2523,7 +2591,13 @@
 //#define NO_TIMEOUTS 1000 // (ms)
 
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
-//#define ADVANCED_OK
+// @advi3++: Lets the host keep several commands in flight (see docs/Queue.md and
+// buildroot/share/scripts/window_sender.py)
+#define ADVANCED_OK
+
+// @advi3++: Report the planner and command queue free space, underruns and longest
+// starvation with M576 [S<seconds>] (D576 with MARLIN_DEV_MODE upstream)
+#define BUFFER_MONITORING
 
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
@@ -3730,13 +3804,20 @@
 
 #if ENABLED(FASTER_GCODE_PARSER)
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+  #define BINARY_GCODE            // Print pre-tokenized .GCB files (buildroot/share/scripts/gcode2gcb.py) @advi3++
+  #define GCODE_TOKENIZER         // Checksum and index lines while they are received (+38 bytes of SRAM per command) @advi3++
 #endif
 
+#define FAST_NUMBER_PARSER        // Parse G-code numbers without strtof / strtol (no exponents) @advi3++
+
 /**
  * Support for MeatPack G-code compression (https://github.com/scottmudge/OctoPrint-MeatPack)
  */
-//#define MEATPACK_ON_SERIAL_PORT_1
+#define MEATPACK_ON_SERIAL_PORT_1 // @advi3++
 //#define MEATPACK_ON_SERIAL_PORT_2
+#if ANY(MEATPACK_ON_SERIAL_PORT_1, MEATPACK_ON_SERIAL_PORT_2)
+  #define MEATPACK_LOOKUP_TABLE     // Decode with a 512-byte PROGMEM table instead of 16 bytes of SRAM @advi3++
+#endif
 
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
@@ -4294,13 +4375,12 @@
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
 
-#if ENABLED(MARLIN_DEV_MODE)
-  /**
-   * D576 - Buffer Monitoring
-   * To help diagnose print quality issues stemming from empty command buffers.
-   */
-  //#define BUFFER_MONITORING
-#endif
+// @advi3++: BUFFER_MONITORING (M576) is with ADVANCED_OK
+
+// @advi3++: Measure the time spent in the zones of the main loop (loop, idle, temperature, queue,
+// planner, LCD and DGUS): calls, min, average and max. Reported by M577 (M577 R resets).
+// Each zone costs two calls to micros(). The values are not shown on the LCD Panel.
+//#define HOT_PATH_PROFILER
 
 /**
  * Postmortem Debugging captures misbehavior and outputs the CPU status and backtrace to serial.
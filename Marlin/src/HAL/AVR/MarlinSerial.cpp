@@ -556,6 +556,15 @@ void MarlinSerial<Cfg>::flushTX() {
   }
 }
 
+// @advi3++: Clear the RX statistics (the counters are updated by the RX ISR)
+template<typename Cfg>
+void MarlinSerial<Cfg>::reset_stats() {
+  CRITICAL_SECTION_START();
+  rx_dropped_bytes = rx_buffer_overruns = rx_framing_errors = 0;
+  rx_max_enqueued = 0;
+  CRITICAL_SECTION_END();
+}
+
 // Hookup ISR handlers
 ISR(SERIAL_REGNAME(USART, SERIAL_PORT, _RX_vect)) {
   MarlinSerial<MarlinSerialCfg<SERIAL_PORT>>::store_rxd_char();
@@ -33,6 +33,7 @@
 #include "HAL/shared/Delay.h"
 #include "HAL/shared/esp_wifi.h"
 #include "HAL/shared/cpu_exception/exception_hook.h"
+#include "libs/profiler.h" // @advi3++
 
 #if ENABLED(WIFISUPPORT)
   #include "HAL/shared/esp_wifi.h"
@@ -186,6 +187,10 @@
   #include "feature/powerloss.h"
 #endif
 
+#if ENABLED(JOB_STATISTICS)
+  #include "feature/jobstats.h" // @advi3++
+#endif
+
 #if ENABLED(CANCEL_OBJECTS)
   #include "feature/cancel_object.h"
 #endif
@@ -780,6 +785,8 @@ void idle(const bool no_stepper_sleep/*=false*/) {
     CodeProfiler idle_profiler;
   #endif
 
+  PROFILE_ZONE(IDLE); // @advi3++
+
   #if ENABLED(MARLIN_DEV_MODE)
     static uint16_t idle_depth = 0;
     if (++idle_depth > 5) SERIAL_ECHOLNPGM("idle() call depth: ", idle_depth);
@@ -837,6 +844,7 @@ void idle(const bool no_stepper_sleep/*=false*/) {
 
   // Update the Print Job Timer state
   TERN_(PRINTCOUNTER, print_job_timer.tick());
+  TERN_(JOB_STATISTICS, job_stats.tick()); // @advi3++
 
   // Update the Beeper queue
   TERN_(HAS_BEEPER, buzzer.tick());
@@ -1678,6 +1686,8 @@ void setup() {
  */
 void loop() {
   do {
+    PROFILE_ZONE(LOOP); // @advi3++
+
     idle();
 
     #if HAS_MEDIA
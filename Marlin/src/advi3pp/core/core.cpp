@@ -28,6 +28,7 @@
 #include "dgus.h"
 #include "buzzer.h"
 #include "reentrant.h"
+#include "../../libs/profiler.h"
 #include "wait.h"
 #include "../screens/leveling/no_sensor.h"
 #include "../screens/controls/controls.h"
@@ -126,6 +127,7 @@ bool Core::init() {
 }
 
 void Core::idle() {
+  PROFILE_ZONE(LCD);
   static Reentrant reentrant;
   ReentrantScope scope{reentrant};
 
@@ -141,9 +143,11 @@ void Core::idle() {
 }
 
 void Core::to_lcd() {
+  PROFILE_ZONE(DGUS);
   update_progress();
   send_lcd_data();
   graphs.update();
+  statistics.check_serial_losses();
   send_lcd_touch_request();
 }
 
@@ -168,6 +172,7 @@ void Core::update_progress() {
 
 //! Read a frame from the LCD and act accordingly.
 void Core::from_lcd() {
+  PROFILE_ZONE(DGUS);
   if(dimming.receive())
     return;
 
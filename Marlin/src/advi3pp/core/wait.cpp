@@ -118,9 +118,13 @@ void Wait::wait_user(const char* message, bool awaiting) {
   }
 }
 
+//! Home the printer and call a callback when it is done
+//! @param homed    Callback to be called when the printer is homed
+//! @param command  G-code to inject (G28 Z O by default)
 void Wait::homing(const WaitCallback& homed, const FlashChar* command) {
   Log::log() << F("homing: Set callback") << Log::endl();
   continue_ = homed;
+  homing_ = Homing::Requested;
   status.set(F("Homing..."));
   pages.show(Page::Waiting, ACTION);
   core.inject_commands(command == nullptr ? F("G28 Z O") : command);
@@ -131,10 +135,37 @@ void Wait::homing(const FlashChar* command) {
   homing(WaitCallback{nullptr}, command);
 }
 
+//! G28 has started to home the axes
+void Wait::homing_start() {
+  if(homing_ == Homing::Requested) homing_ = Homing::Homing;
+}
+
+//! An axis is being homed. Called from homeaxis(), inside the blocking G28.
+void Wait::homing_axis_start(ExtUI::axis_t axis) {
+  status.format(F("Homing %c..."), static_cast<char>('X' + axis));
+}
+
+//! The homing of an axis has ended, successfully or not. Called on every exit of homeaxis().
+void Wait::homing_axis_done(ExtUI::axis_t axis, bool success) {
+  const char name = static_cast<char>('X' + axis);
+  if(success) status.format(F("%c homed"), name);
+  else status.format(F("Homing %c failed"), name);
+}
+
+//! G28 has homed all the axes
+void Wait::homing_done() {
+  if(homing_ == Homing::Homing) homing_ = Homing::Homed;
+}
+
+//! Wait for the end of the homing and of the commands that follow it.
+//! If G28 O skipped the homing, the machine is already homed.
 void Wait::home_task() {
-  if (core.is_busy() || !ExtUI::isMachineHomed())
+  if(core.is_busy())
+    return;
+  if(homing_ != Homing::Homed && !(homing_ == Homing::Requested && ExtUI::isMachineHomed()))
     return;
   Log::log() << F("Homed") << Log::endl();
+  homing_ = Homing::None;
   background_task.clear();
   pages.clear_temporaries();
   if(continue_) reset_and_call(continue_);
@@ -45,6 +45,10 @@ struct Wait: Screen<Wait> {
   void wait_user(const char* message, bool awaiting);
   void homing(const WaitCallback& homed, const FlashChar* command = nullptr);
   void homing(const FlashChar* command = nullptr);
+  void homing_start();
+  void homing_axis_start(ExtUI::axis_t axis);
+  void homing_axis_done(ExtUI::axis_t axis, bool success);
+  void homing_done();
 
 private:
   void on_save_command();
@@ -57,8 +61,13 @@ private:
   static bool reset_and_call(WaitCallback &callback);
 
 private:
+  //! Progress of the homing requested by this screen, only to display it and to know when it ends.
+  //! G28 itself is blocking: it runs from the command queue and calls idle() (and so Core::idle) while moving.
+  enum class Homing: uint8_t { None, Requested, Homing, Homed };
+
   WaitCallback back_;
   WaitCallback continue_;
+  Homing homing_ = Homing::None;
 
   friend Parent;
 };
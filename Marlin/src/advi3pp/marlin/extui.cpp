@@ -28,6 +28,7 @@
 #include "../screens/leveling/automatic.h"
 #include "../screens/tuning/pid_tuning.h"
 #include "../screens/print/change_temperature.h"
+#include "../screens/print/print.h"
 
 namespace ExtUI {
 
@@ -119,11 +120,23 @@ void onStatusChanged(const char * const msg) {
 void onHomingStart() {
   Log::log() << F("ExtUI::onHomingStart") << Log::endl();
   status.set(F("Homing..."));
+  wait.homing_start();
+}
+
+void onHomingAxisStart(const axis_t axis) {
+  Log::log() << F("ExtUI::onHomingAxisStart") << Log::endl();
+  wait.homing_axis_start(axis);
+}
+
+void onHomingAxisDone(const axis_t axis, const bool success) {
+  Log::log() << F("ExtUI::onHomingAxisDone") << Log::endl();
+  wait.homing_axis_done(axis, success);
 }
 
 void onHomingDone() {
   Log::log() << F("ExtUI::onHomingDone") << Log::endl();
   status.reset_and_clear();
+  wait.homing_done();
 }
 
 void onSteppersDisabled() {
@@ -199,6 +212,18 @@ void onLevelingDone(bool success) {
   automatic_leveling.on_done(success);
 }
 
+#if ENABLED(BED_TEMP_Z_COMPENSATION)
+void onBedTempZProgress(const uint8_t index, const celsius_t temp) {
+  Log::log() << F("ExtUI::onBedTempZProgress") << Log::endl();
+  automatic_leveling.on_bed_temperature_progress(index, temp);
+}
+
+void onBedTempZDone(bool success) {
+  Log::log() << F("ExtUI::onBedTempZDone") << Log::endl();
+  automatic_leveling.on_bed_temperature_done(success);
+}
+#endif
+
 void onMeshUpdate(const int8_t xpos, const int8_t ypos, const_float_t zval) {
   // Called when any mesh point is updated
   Log::log() << F("ExtUI::onMediaOpenError") << Log::endl();
@@ -210,10 +235,18 @@ void onMeshUpdate(const int8_t xpos, const int8_t ypos, probe_state_t state) {
 }
 
 #if ENABLED(POWER_LOSS_RECOVERY)
-void onPowerLossResume()
-{
-    // Called on resume from power-loss
-    Facade::on_power_less_resume();
+void onSetPowerLoss(const bool onoff) {
+  Log::log() << F("ExtUI::onSetPowerLoss") << Log::endl();
+}
+
+void onPowerLoss() {
+  Log::log() << F("ExtUI::onPowerLoss") << Log::endl();
+}
+
+void onPowerLossResume() {
+  // Called on resume from power-loss
+  Log::log() << F("ExtUI::onPowerLossResume") << Log::endl();
+  print.on_power_loss_resume();
 }
 #endif
 
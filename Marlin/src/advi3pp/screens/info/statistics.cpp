@@ -22,6 +22,7 @@
 #include "statistics.h"
 #include "../../core/string.h"
 #include "../../core/dgus.h"
+#include "../../core/status.h"
 
 namespace ADVi3pp {
 
@@ -55,4 +56,16 @@ void Statistics::send_stats() {
   WriteRamRequest{Variable::LongText2}.write_text(value);
 }
 
+//! Display a message when bytes are lost by the host serial port (overruns or RX buffer full).
+//! The Statistics page has no room for them so they are displayed in the status message.
+void Statistics::check_serial_losses() {
+  const uint8_t overruns = MYSERIAL1.buffer_overruns(), dropped = MYSERIAL1.dropped();
+  if(overruns == serial_overruns_ && dropped == serial_dropped_)
+    return;
+  serial_overruns_ = overruns;
+  serial_dropped_ = dropped;
+  if(overruns || dropped) // Zero after M111 R
+    status.format(F("Serial: %u overruns, %u bytes dropped"), overruns, dropped);
+}
+
 }
@@ -29,10 +29,16 @@ struct Statistics: Screen<Statistics> {
   static constexpr Page PAGE = Page::Statistics;
   static constexpr Action ACTION = Action::Statistics;
 
+  void check_serial_losses();
+
 private:
   bool on_enter();
   void send_stats();
   friend Parent;
+
+private:
+  uint8_t serial_overruns_ = 0;
+  uint8_t serial_dropped_ = 0;
 };
 
 extern Statistics statistics;
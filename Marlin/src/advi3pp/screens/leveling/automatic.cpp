@@ -95,6 +95,25 @@ void AutomaticLeveling::on_progress(uint8_t index, uint8_t x, uint8_t y) {
   WriteRamRequest{Variable::Value0}.write_words_data(data.data(), data.size());
 }
 
+//! Called by Marlin when the bed is heated to the next temperature of M870 C.
+//! @param index Index of the temperature, starting at 1.
+//! @param temperature Temperature of the bed.
+void AutomaticLeveling::on_bed_temperature_progress(uint8_t index, celsius_t temperature) {
+  status.format(F("Bed at %i C, probing #%i"), temperature, index);
+}
+
+//! Called by Marlin when M870 C (bed temperature Z compensation) is finished.
+//! @param success Boolean indicating if the measures were successful or not.
+void AutomaticLeveling::on_bed_temperature_done(bool success) {
+  if(!success) {
+    status.set(F("Bed temperature compensation failure or aborted"));
+    return;
+  }
+
+  settings.save();
+  status.set(F("Bed temperature compensation saved"));
+}
+
 //! Called by Marlin when G29 (automatic bed leveling) is finished.
 //! @param success Boolean indicating if the leveling was successful or not.
 void AutomaticLeveling::on_done(bool success) {
@@ -36,6 +36,8 @@ struct AutomaticLeveling: Screen<AutomaticLeveling> {
 
   void on_progress(uint8_t index, uint8_t x, uint8_t y);
   void on_done(bool success);
+  void on_bed_temperature_progress(uint8_t index, celsius_t temperature);
+  void on_bed_temperature_done(bool success);
 
 private:
   bool on_dispatch(KeyValue key_value);
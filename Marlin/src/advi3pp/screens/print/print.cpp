@@ -23,6 +23,9 @@
 #include "../../core/core.h"
 #include "../../core/status.h"
 #include "../../core/wait.h"
+#if ENABLED(POWER_LOSS_RECOVERY)
+#include "../../../feature/powerloss.h"
+#endif
 
 
 namespace ADVi3pp {
@@ -99,4 +102,26 @@ void Print::advanced_pause_command() {
   core.inject_commands(F("M600"));
 }
 
+#if ENABLED(POWER_LOSS_RECOVERY)
+//! A print was interrupted by a power loss, ask to resume it
+void Print::on_power_loss_resume() {
+  wait.wait_back_continue(F("Resume interrupted print?"),
+  WaitCallback{this, &Print::cancel_power_loss_resume}, WaitCallback{this, &Print::power_loss_resume});
+}
+
+bool Print::cancel_power_loss_resume() {
+  status.set(F("Print not resumed"));
+  core.inject_commands(F("M1000 C"));
+  return true;
+}
+
+bool Print::power_loss_resume() {
+  status.set_filename(recovery.info.sd_filename);
+  pages.clear_temporaries();
+  core.inject_commands(F("M1000"));
+  pages.show(Page::Print, Action::Print);
+  return false;
+}
+#endif
+
 }
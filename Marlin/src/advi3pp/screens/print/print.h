@@ -29,6 +29,10 @@ struct Print: Screen<Print> {
   static constexpr Page PAGE = Page::Print;
   static constexpr Action ACTION = Action::Print;
 
+#if ENABLED(POWER_LOSS_RECOVERY)
+  void on_power_loss_resume();
+#endif
+
 private:
   bool on_dispatch(KeyValue value);
   bool on_enter();
@@ -38,6 +42,10 @@ private:
   bool abort_print();
   void pause_resume_command();
   void advanced_pause_command();
+#if ENABLED(POWER_LOSS_RECOVERY)
+  bool cancel_power_loss_resume();
+  bool power_loss_resume();
+#endif
 
 private:
 
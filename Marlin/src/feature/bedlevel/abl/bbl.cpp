@@ -28,6 +28,14 @@
 
 #include "../../../module/motion.h"
 
+#if EITHER(BED_TEMP_Z_COMPENSATION, HAS_BILINEAR_MESH_SLOTS)
+  #include "../../../module/temperature.h" // @advi3++
+#endif
+
+#if ENABLED(ADAPTIVE_LEVELED_SEGMENTS)
+  #include "leveled_segments.h" // @advi3++
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../../core/debug_out.h"
 
@@ -43,6 +51,12 @@ xy_float_t LevelingBilinear::grid_factor;
 bed_mesh_t LevelingBilinear::z_values;
 xy_pos_t LevelingBilinear::cached_rel;
 xy_int8_t LevelingBilinear::cached_g;
+#if ENABLED(ABL_BILINEAR_COEFFICIENTS)
+  decltype(LevelingBilinear::coefficients) LevelingBilinear::coefficients; // @advi3++
+#endif
+#if ENABLED(BED_TEMP_Z_COMPENSATION)
+  BedTempZ LevelingBilinear::temp_z; // @advi3++
+#endif
 
 /**
  * Extrapolate a single point from its neighbors
@@ -261,13 +275,6 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
 
 #endif // ABL_BILINEAR_SUBDIVISION
 
-// Refresh after other values have been updated
-void LevelingBilinear::refresh_bed_level() {
-  TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
-  cached_rel.x = cached_rel.y = -999.999;
-  cached_g.x = cached_g.y = -99;
-}
-
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
   #define ABL_BG_SPACING(A) grid_spacing_virt.A
   #define ABL_BG_FACTOR(A)  grid_factor_virt.A
@@ -282,9 +289,52 @@ void LevelingBilinear::refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
+// Refresh after other values have been updated
+void LevelingBilinear::refresh_bed_level() {
+  TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
+  TERN_(ABL_BILINEAR_COEFFICIENTS, coefficients.set([](const uint8_t x, const uint8_t y) { return ABL_BG_GRID(x, y); })); // @advi3++
+  cached_rel.x = cached_rel.y = -999.999;
+  cached_g.x = cached_g.y = -99;
+  TERN_(BED_TEMP_Z_COMPENSATION, temp_z.invalidate()); // @advi3++
+}
+
+// @advi3++
+#if ENABLED(BED_TEMP_Z_COMPENSATION)
+
+  // Z offset of the mesh for the target temperature of the bed
+  float LevelingBilinear::get_z_offset() {
+    return temp_z.offset(thermalManager.degTargetBed());
+  }
+
+#endif
+
+// @advi3++
+#if HAS_BILINEAR_MESH_SLOTS
+
+  void LevelingBilinear::get_slot(mesh_slot_t &slot) {
+    slot.bed_temp = TERN(BED_TEMP_Z_COMPENSATION, temp_z.mesh_temp(), thermalManager.degTargetBed());
+    slot.grid_spacing = grid_spacing;
+    slot.grid_start = grid_start;
+    COPY(slot.z_values, z_values);
+  }
+
+  void LevelingBilinear::set_slot(const mesh_slot_t &slot) {
+    set_grid(slot.grid_spacing, slot.grid_start);
+    COPY(z_values, slot.z_values);
+    TERN_(BED_TEMP_Z_COMPENSATION, temp_z.set_mesh_temp(slot.bed_temp));
+    refresh_bed_level();
+  }
+
+#endif
+
 // Get the Z adjustment for non-linear bed leveling
 float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
+  // @advi3++
+  #if ENABLED(ABL_BILINEAR_COEFFICIENTS)
+    return coefficients.get((raw.x - grid_start.x) * ABL_BG_FACTOR(x), (raw.y - grid_start.y) * ABL_BG_FACTOR(y));
+  #else
+
   static float z1, d2, z3, d4, L, D;
 
   static xy_pos_t ratio;
@@ -364,6 +414,8 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
   //*/
 
   return offset;
+
+  #endif // !ABL_BILINEAR_COEFFICIENTS
 }
 
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
@@ -434,6 +486,74 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
     line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
   }
 
-#endif // IS_CARTESIAN && !SEGMENT_LEVELED_MOVES
+#elif ENABLED(ADAPTIVE_LEVELED_SEGMENTS) // @advi3++
+
+  #define CELL_INDEX(A,V) ((V - grid_start.A) * ABL_BG_FACTOR(A))
+
+  /**
+   * Prepare a bilinear-leveled linear move on Cartesian,
+   * splitting the move where it crosses grid borders.
+   *
+   * Inside a cell, the correction along the move is a parabola. Its distance
+   * to the chord is a quarter of its second order term which only depends on
+   * the twist of the cell. The move is split in as few segments as needed to
+   * stay within LEVELED_SEGMENT_TOLERANCE (none for a flat or tilted cell),
+   * see leveled_segments.h.
+   */
+  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s) {
+    const xyze_pos_t start = current_position, end = destination;
+    const xyze_float_t diff = end - start;
+
+    // Beyond the grid the correction is flat, so the edges of the grid are also split
+    #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+      constexpr int first = 0, last_x = ABL_BG_POINTS_X - 2, last_y = ABL_BG_POINTS_Y - 2;
+    #else
+      constexpr int first = -1, last_x = ABL_BG_POINTS_X - 1, last_y = ABL_BG_POINTS_Y - 1;
+    #endif
+
+    // Get current and destination cells for this line
+    xy_int_t c1 { int(FLOOR(CELL_INDEX(x, start.x))), int(FLOOR(CELL_INDEX(y, start.y))) },
+             c2 { int(FLOOR(CELL_INDEX(x, end.x))), int(FLOOR(CELL_INDEX(y, end.y))) };
+    LIMIT(c1.x, first, last_x);
+    LIMIT(c1.y, first, last_y);
+    LIMIT(c2.x, first, last_x);
+    LIMIT(c2.y, first, last_y);
+
+    // Second order term of the correction along the whole move, without the twist
+    const float cells_xy = ABS(diff.x * ABL_BG_FACTOR(x) * diff.y * ABL_BG_FACTOR(y));
+
+    #define CELL_EXIT(A) (c1.A == c2.A ? 1.0f : (grid_start.A + ABL_BG_SPACING(A) * (c1.A + (c2.A > c1.A)) - start.A) / diff.A)
+
+    for (float t1 = 0;;) {
+      // Fraction of the move where it leaves the cell on the X and on the Y
+      const float tx = CELL_EXIT(x), ty = CELL_EXIT(y),
+                  t2 = _MAX(t1, _MIN(tx, ty)), dt = t2 - t1;
+
+      const bool in_grid = WITHIN(c1.x, 0, ABL_BG_POINTS_X - 2) && WITHIN(c1.y, 0, ABL_BG_POINTS_Y - 2);
+      const float twist = !in_grid ? 0.0f : ABL_BG_GRID(c1.x, c1.y) - ABL_BG_GRID(c1.x + 1, c1.y)
+                                          - ABL_BG_GRID(c1.x, c1.y + 1) + ABL_BG_GRID(c1.x + 1, c1.y + 1);
+      const uint16_t segments = leveled_segments(twist, cells_xy, dt, LEVELED_SEGMENT_TOLERANCE);
+
+      for (uint16_t i = 1; i < segments; ++i) {
+        current_position = start + diff * (t1 + dt * i / segments);
+        line_to_current_position(scaled_fr_mm_s);
+      }
+
+      // The last move must be to the exact destination
+      if (t2 >= 1.0f) break;
+      current_position = start + diff * t2;
+      line_to_current_position(scaled_fr_mm_s);
+
+      // Next cell (both X and Y at a corner)
+      if (tx <= ty) c1.x += c2.x > c1.x ? 1 : -1;
+      if (ty <= tx) c1.y += c2.y > c1.y ? 1 : -1;
+      t1 = t2;
+    }
+
+    current_position = end;
+    line_to_current_position(scaled_fr_mm_s);
+  }
+
+#endif // IS_CARTESIAN && (!SEGMENT_LEVELED_MOVES || ADAPTIVE_LEVELED_SEGMENTS)
 
 #endif // AUTO_BED_LEVELING_BILINEAR
@@ -23,10 +23,20 @@
 
 #include "../../../inc/MarlinConfigPre.h"
 
+#if ENABLED(ABL_BILINEAR_COEFFICIENTS)
+  #include "bilinear_coefficients.h" // @advi3++
+#endif
+#if ENABLED(BED_TEMP_Z_COMPENSATION)
+  #include "bed_temp_z.h" // @advi3++
+#endif
+
 class LevelingBilinear {
 public:
   static bed_mesh_t z_values;
   static xy_pos_t grid_spacing, grid_start;
+  #if ENABLED(BED_TEMP_Z_COMPENSATION)
+    static BedTempZ temp_z; // @advi3++
+  #endif
 
 private:
   static xy_float_t grid_factor;
@@ -49,6 +59,15 @@ private:
     static void subdivide_mesh();
   #endif
 
+  // @advi3++
+  #if ENABLED(ABL_BILINEAR_COEFFICIENTS)
+    #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+      static BilinearCoefficients<ABL_GRID_POINTS_VIRT_X - 1, ABL_GRID_POINTS_VIRT_Y - 1, ENABLED(EXTRAPOLATE_BEYOND_GRID)> coefficients;
+    #else
+      static BilinearCoefficients<GRID_MAX_CELLS_X, GRID_MAX_CELLS_Y, ENABLED(EXTRAPOLATE_BEYOND_GRID)> coefficients;
+    #endif
+  #endif
+
 public:
   static void reset();
   static void set_grid(const xy_pos_t& _grid_spacing, const xy_pos_t& _grid_start);
@@ -60,10 +79,28 @@ public:
   static float get_mesh_x(const uint8_t i) { return grid_start.x + i * grid_spacing.x; }
   static float get_mesh_y(const uint8_t j) { return grid_start.y + j * grid_spacing.y; }
   static float get_z_correction(const xy_pos_t &raw);
-  static constexpr float get_z_offset() { return 0.0f; }
+  #if ENABLED(BED_TEMP_Z_COMPENSATION)
+    static float get_z_offset(); // @advi3++
+  #else
+    static constexpr float get_z_offset() { return 0.0f; }
+  #endif
+
+  // @advi3++
+  #if HAS_BILINEAR_MESH_SLOTS
+    // Mesh stored in a slot of the EEPROM (M424)
+    struct mesh_slot_t {
+      celsius_t bed_temp;   // Target temperature of the bed when the mesh was probed, -1 if the slot is empty
+      xy_pos_t grid_spacing, grid_start;
+      bed_mesh_t z_values;
+    };
+    static void get_slot(mesh_slot_t &slot);
+    static void set_slot(const mesh_slot_t &slot);
+  #endif
 
   #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
     static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
+  #elif ENABLED(ADAPTIVE_LEVELED_SEGMENTS) // @advi3++
+    static void line_to_destination(const_feedRate_t scaled_fr_mm_s);
   #endif
 };
 
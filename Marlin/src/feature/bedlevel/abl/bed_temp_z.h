@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * BED_TEMP_Z_COMPENSATION - @advi3++
+ *
+ * Height of the center of the bed for BED_TEMP_Z_COUNT temperatures, from BED_TEMP_Z_START
+ * by steps of BED_TEMP_Z_RES, in microns relative to the first temperature. The offset
+ * applied to the mesh is the height at the target temperature minus the height at the
+ * temperature of the mesh, interpolated between the temperatures and constant beyond.
+ */
+
+struct BedTempZ {
+  static constexpr celsius_t START = BED_TEMP_Z_START, RES = BED_TEMP_Z_RES;
+  static constexpr uint8_t COUNT = BED_TEMP_Z_COUNT;
+
+  // Saved in the EEPROM
+  struct Data {
+    int16_t z[COUNT];     // Height of the bed (µm)
+    celsius_t mesh_temp;  // Target temperature of the bed when the mesh was probed
+  };
+
+  static constexpr celsius_t temperature(const uint8_t index) { return START + index * RES; }
+
+  void reset() {
+    for (uint8_t i = 0; i < COUNT; ++i) data_.z[i] = 0;
+    data_.mesh_temp = START;
+    invalidate();
+  }
+
+  const Data& data() const { return data_; }
+  int16_t z(const uint8_t index) const { return data_.z[index]; }
+  celsius_t mesh_temp() const { return data_.mesh_temp; }
+
+  void set(const Data &data) { data_ = data; invalidate(); }
+  void set_z(const uint8_t index, const int16_t z) { data_.z[index] = z; invalidate(); }
+  void set_mesh_temp(const celsius_t temp) { data_.mesh_temp = temp; invalidate(); }
+  void invalidate() { cached_temp_ = NO_TEMP; }
+
+  // Height of the bed (µm) at a temperature
+  int16_t height(const celsius_t temp) const {
+    if (temp <= START) return data_.z[0];
+    const uint16_t delta = temp - START;
+    const uint8_t index = delta / RES;
+    if (index >= COUNT - 1) return data_.z[COUNT - 1];
+    return data_.z[index] + int16_t(int32_t(data_.z[index + 1] - data_.z[index]) * (delta - index * RES) / RES);
+  }
+
+  // Offset (mm) to add to the mesh at a temperature, computed again only when the temperature
+  // or the model changes (it is added to each planned move)
+  float offset(const celsius_t temp) {
+    if (temp != cached_temp_) {
+      cached_temp_ = temp;
+      cached_offset_ = (height(temp) - height(data_.mesh_temp)) * 0.001f;
+    }
+    return cached_offset_;
+  }
+
+private:
+  static constexpr celsius_t NO_TEMP = -1000;
+
+  Data data_;
+  celsius_t cached_temp_ = NO_TEMP;
+  float cached_offset_ = 0;
+};
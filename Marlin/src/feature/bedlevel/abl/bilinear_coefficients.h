@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * ABL_BILINEAR_COEFFICIENTS - @advi3++
+ *
+ * The bilinear surface of each cell of the grid, z = a + b.u + c.v + d.u.v with u and v
+ * the position inside the cell (0 to 1), precomputed in 1/1024 mm when the mesh changes.
+ * A correction is then a cell index (the upper bits of the position in the grid, in
+ * 1/4096 of cell) and three integer multiply-adds with the lower bits, instead of the
+ * float ratios, FLOOR and interpolations of get_z_correction.
+ *
+ * Heights are limited to +/-8 mm and the extrapolation beyond the grid to 2 cells so
+ * the computations fit in 32 bits. 8 bytes of RAM per cell (4 cells for a 3x3 grid).
+ */
+
+template<uint8_t CELLS_X, uint8_t CELLS_Y, bool EXTRAPOLATE>
+struct BilinearCoefficients {
+  static constexpr uint8_t Z_BITS = 10;
+  static constexpr uint8_t FRACTION_BITS = 12;
+  static constexpr int32_t ROUND = 1L << (FRACTION_BITS - 1);
+  static constexpr float Z_MAX = 8191.0f / (1 << Z_BITS);
+  static constexpr float BEYOND = EXTRAPOLATE ? 2.0f : 0.0f;
+
+  struct Cell { int16_t a, b, c, d; };
+  Cell cells[CELLS_X][CELLS_Y];
+
+  // Build the coefficients from the height of the grid points, z(x, y)
+  template<typename Z>
+  void set(const Z &z) {
+    for (uint8_t x = 0; x < CELLS_X; ++x)
+      for (uint8_t y = 0; y < CELLS_Y; ++y) {
+        const int16_t z00 = to_fixed(z(x, y)), z10 = to_fixed(z(x + 1, y)),
+                      z01 = to_fixed(z(x, y + 1)), z11 = to_fixed(z(x + 1, y + 1));
+        cells[x][y] = { z00, int16_t(z10 - z00), int16_t(z01 - z00), int16_t(z11 - z10 - z01 + z00) };
+      }
+  }
+
+  // Correction at a position in the grid, in cells from the first grid point
+  float get(const float cx, const float cy) const {
+    const int32_t gx = to_grid(cx, CELLS_X), gy = to_grid(cy, CELLS_Y);
+    const int8_t x = constrain(gx >> FRACTION_BITS, int32_t(0), int32_t(CELLS_X - 1)),
+                 y = constrain(gy >> FRACTION_BITS, int32_t(0), int32_t(CELLS_Y - 1));
+    const int32_t u = gx - (int32_t(x) << FRACTION_BITS), v = gy - (int32_t(y) << FRACTION_BITS);
+    const Cell &k = cells[x][y];
+    const int32_t z = k.a + ((k.b * u + (k.c + ((k.d * u + ROUND) >> FRACTION_BITS)) * v + ROUND) >> FRACTION_BITS);
+    return z * (1.0f / (1 << Z_BITS));
+  }
+
+private:
+  static int16_t to_fixed(const float z) {
+    if (isnan(z)) return 0;
+    const float limited = constrain(z, -Z_MAX, Z_MAX) * (1 << Z_BITS);
+    return int16_t(limited < 0 ? limited - 0.5f : limited + 0.5f);
+  }
+
+  // Position in the grid in 1/4096 of cell. Without EXTRAPOLATE, the height of the edges is kept.
+  static int32_t to_grid(const float c, const uint8_t cells) {
+    return int32_t((constrain(c, -BEYOND, cells + BEYOND) + BEYOND) * (1L << FRACTION_BITS) + 0.5f) - int32_t(BEYOND * (1L << FRACTION_BITS));
+  }
+};
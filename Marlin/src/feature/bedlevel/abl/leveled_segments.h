@@ -0,0 +1,40 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * ADAPTIVE_LEVELED_SEGMENTS - @advi3++
+ *
+ * Along a straight move inside a cell, the bilinear correction is a parabola whose
+ * second order term is twist . dx . dy (twist = z00 - z10 - z01 + z11, dx and dy the
+ * move in cells). Its largest distance to the chord is a quarter of this term and
+ * n segments divide it by n², so n = ceil(sqrt(deviation / tolerance)).
+ *
+ * twist      Twist of the cell (mm)
+ * cells_xy   |dx . dy| of the whole move, in cells²
+ * dt         Fraction of the move inside the cell
+ * tolerance  Maximal distance of a segment to the surface (mm)
+ */
+inline uint16_t leveled_segments(const float twist, const float cells_xy, const float dt, const float tolerance) {
+  const float deviation = fabsf(twist) * cells_xy * dt * dt * 0.25f;
+  return deviation > tolerance ? uint16_t(ceilf(sqrtf(deviation / tolerance))) : 1;
+}
@@ -26,17 +26,30 @@
 #define BINARY_STREAM_COMPRESSION
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   #include "../libs/heatshrink/heatshrink_decoder.h"
-  // STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
-  static __attribute__((aligned(sizeof(size_t)))) uint8_t decode_buffer[512] = {};
+  #if ENABLED(SD_STREAM)
+    // @advi3++ Decode into a sector buffer of SdStream, unused while a file is written (saves 512 bytes of SRAM)
+    static uint8_t *decode_buffer = nullptr;
+  #else
+    // STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
+    static __attribute__((aligned(sizeof(size_t)))) uint8_t decode_buffer[512] = {};
+  #endif
+  static constexpr size_t decode_buffer_size = 512; // @advi3++
   static heatshrink_decoder hsd;
 #endif
 
+// @advi3++ MeatPack would interpret the 0xFF 0xFF sequences of the packets: read the port itself
+#if ENABLED(MEATPACK_ON_SERIAL_PORT_1) && !HAS_MULTI_SERIAL
+  #define BS_SERIAL _SERIAL_LEAF_1
+#else
+  #define BS_SERIAL SERIAL_IMPL
+#endif
+
 inline bool bs_serial_data_available(const serial_index_t index) {
-  return SERIAL_IMPL.available(index);
+  return BS_SERIAL.available(index);
 }
 
 inline int bs_read_serial(const serial_index_t index) {
-  return SERIAL_IMPL.read(index);
+  return BS_SERIAL.read(index);
 }
 
 class SDFileTransferProtocol  {
@@ -64,7 +77,11 @@ private:
       card.mount();
       card.openFileWrite(filename);
       if (!card.isFileOpen()) return false;
+      card.diskIODriver()->writeBehind(true); // @advi3++ Overlap the flashing of the blocks with the next packets
     }
+    #if ALL(BINARY_STREAM_COMPRESSION, SD_STREAM)
+      if (compression && !(decode_buffer = SdStream::lend())) return false; // @advi3++ Dummy transfer while printing
+    #endif
     transfer_active = true;
     data_waiting = 0;
     TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_reset(&hsd));
@@ -81,9 +98,9 @@ private:
           heatshrink_decoder_sink(&hsd, reinterpret_cast<uint8_t*>(&buffer[total_processed]), length - total_processed, &processed_count);
           total_processed += processed_count;
           do {
-            presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting, &processed_count);
+            presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], decode_buffer_size - data_waiting, &processed_count);
             data_waiting += processed_count;
-            if (data_waiting == sizeof(decode_buffer)) {
+            if (data_waiting == decode_buffer_size) {
               if (!dummy_transfer)
                 if (card.write(decode_buffer, data_waiting) < 0) {
                   return false;
@@ -107,6 +124,8 @@ private:
           data_waiting = 0;
         }
       #endif
+      // @advi3++ Wait for the last block and check it. The directory entry is written with a checked write.
+      if (!card.diskIODriver()->writeBehind(false)) return false;
       card.closefile();
       card.release();
     }
@@ -117,6 +136,7 @@ private:
 
   static void transfer_abort() {
     if (!dummy_transfer) {
+      card.diskIODriver()->writeBehind(false); // @advi3++
       card.closefile();
       card.removeFile(card.filename);
       card.release();
@@ -0,0 +1,209 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/jobstats.cpp - Statistics of the last print jobs - @advi3++
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(JOB_STATISTICS)
+
+#include "jobstats.h"
+#include "../MarlinCore.h"
+#include "../module/planner.h"
+#include "../module/printcounter.h"
+#include "../module/temperature.h"
+#include "../gcode/queue.h"
+#include "../libs/crc16.h"
+#include "../HAL/shared/eeprom_api.h"
+
+#if ENABLED(SD_STREAM)
+  #include "../sd/SdStream.h"
+#endif
+
+JobStats job_stats;
+
+job_stats_t JobStats::current;
+bool JobStats::running, // = false
+     JobStats::moving;  // = false
+millis_t JobStats::next_ms;
+uint32_t JobStats::hotend_power, JobStats::bed_power, JobStats::samples;
+#if ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS)
+  uint8_t JobStats::overruns_start;
+#endif
+uint16_t JobStats::sd_stalls_start;
+float JobStats::filament_start;
+
+// The ring is in the 128 bytes at the end of the EEPROM (after MarlinSettings::meshes_end)
+constexpr uint8_t JOB_STATS_AREA = 128;
+static_assert(JOB_STATISTICS_COUNT * sizeof(job_stats_t) <= JOB_STATS_AREA, "JOB_STATISTICS_COUNT is too large for the EEPROM area.");
+
+constexpr uint8_t MAX_HEATER_POWER = 127; // soft_pwm_amount, as returned by getHeaterPower
+
+static uint8_t duty(const uint32_t power, const uint32_t samples) {
+  return samples ? uint8_t(power * 100.0f / (samples * MAX_HEATER_POWER) + 0.5f) : 0;
+}
+
+static int address(const uint16_t job) {
+  return persistentStore.capacity() - JOB_STATS_AREA + ((job - 1) % JOB_STATISTICS_COUNT) * sizeof(job_stats_t);
+}
+
+/**
+ * Read the entry of a job in the ring. False if it is empty, invalid or for another job.
+ */
+static bool read_entry(const uint16_t job, job_stats_t &stats) {
+  persistentStore.access_start();
+  persistentStore.read_data(address(job), (uint8_t*)&stats, sizeof(stats));
+  persistentStore.access_finish();
+  uint16_t crc = 0;
+  crc16(&crc, &stats, offsetof(job_stats_t, crc));
+  return stats.job == job && crc == stats.crc;
+}
+
+/**
+ * Number of the last job in the ring, 0 if there is none.
+ */
+static uint16_t last_job() {
+  uint16_t last = 0;
+  job_stats_t stats;
+  for (uint8_t i = 1; i <= JOB_STATISTICS_COUNT; ++i) {
+    // An entry holds the job i plus a multiple of JOB_STATISTICS_COUNT
+    persistentStore.access_start();
+    persistentStore.read_data(address(i), (uint8_t*)&stats, sizeof(stats));
+    persistentStore.access_finish();
+    if (stats.job > last && read_entry(stats.job, stats)) last = stats.job;
+  }
+  return last;
+}
+
+/**
+ * A new job is started (not resumed)
+ */
+void JobStats::start() {
+  memset(&current, 0, sizeof(current));
+  current.job = last_job() + 1;
+  if (!current.job) current.job = 1;
+
+  running = true;
+  moving = false;
+  next_ms = millis() + 1000UL;
+  hotend_power = bed_power = samples = 0;
+
+  TERN_(SERIAL_STATS_RX_BUFFER_OVERRUNS, overruns_start = MYSERIAL1.buffer_overruns());
+  TERN_(SD_STREAM, sd_stalls_start = SdStream::stalls());
+  TERN_(HAS_EXTRUDERS, filament_start = print_job_timer.getStats().filamentUsed);
+}
+
+/**
+ * The job is finished or aborted, save its statistics in the ring
+ */
+void JobStats::stop(const bool finished) {
+  if (!running) return;
+  running = false;
+
+  update();
+  current.finished = finished;
+  current.crc = 0;
+  crc16(&current.crc, &current, offsetof(job_stats_t, crc));
+
+  persistentStore.access_start();
+  persistentStore.write_data(address(current.job), (uint8_t*)&current, sizeof(current));
+  persistentStore.access_finish();
+}
+
+/**
+ * Update the counters, called from idle()
+ */
+void JobStats::tick() {
+  if (!running) return;
+
+  // The moves ran out and there is no command waiting: the input (SD or host) did not keep up
+  const bool has_moves = planner.has_blocks_queued();
+  if (moving && !has_moves && print_job_timer.isRunning() && !wait_for_heatup
+      && !queue.has_commands_queued() && current.starvations < 0xFFFF)
+    ++current.starvations;
+  moving = has_moves;
+
+  const millis_t ms = millis();
+  if (PENDING(ms, next_ms)) return;
+  next_ms += 1000UL;
+
+  if (print_job_timer.isPaused()) ++current.paused;
+  else if (wait_for_heatup) ++current.heating;
+  else ++current.printing;
+
+  TERN_(HAS_HOTEND, hotend_power += thermalManager.getHeaterPower(H_E0));
+  TERN_(HAS_HEATED_BED, bed_power += thermalManager.getHeaterPower(H_BED));
+  ++samples;
+
+  update();
+}
+
+/**
+ * Update the values computed from other counters
+ */
+void JobStats::update() {
+  #if ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS)
+    // M111 R clears the overruns
+    const uint8_t overruns = MYSERIAL1.buffer_overruns();
+    current.overruns = overruns >= overruns_start ? overruns - overruns_start : overruns;
+  #endif
+
+  TERN_(SD_STREAM, current.sd_stalls = SdStream::stalls() - sd_stalls_start);
+  TERN_(HAS_EXTRUDERS, current.filament = print_job_timer.getStats().filamentUsed - filament_start);
+
+  current.hotend_duty = duty(hotend_power, samples);
+  current.bed_duty = duty(bed_power, samples);
+}
+
+/**
+ * Statistics of the running job (index 0) or of the previous ones
+ */
+bool JobStats::read(uint8_t index, job_stats_t &stats) {
+  if (running) {
+    if (!index) { stats = current; return true; }
+    --index;
+  }
+
+  const uint16_t last = last_job();
+  if (index >= JOB_STATISTICS_COUNT || index >= last) return false;
+  return read_entry(last - index, stats);
+}
+
+/**
+ * Show the statistics of the jobs (M78)
+ */
+void JobStats::show() {
+  job_stats_t stats;
+  for (uint8_t i = 0; i <= JOB_STATISTICS_COUNT && read(i, stats); ++i) {
+    SERIAL_ECHOPGM(STR_STATS "Job ", stats.job);
+    SERIAL_ECHOPGM_P(running && !i ? PSTR(" running") : stats.finished ? PSTR(" finished") : PSTR(" aborted"));
+    SERIAL_ECHOLNPGM(
+      ", Printing: ", stats.printing, "s, Heating: ", stats.heating, "s, Paused: ", stats.paused,
+      "s, Starvations: ", stats.starvations, ", Overruns: ", stats.overruns, ", SD stalls: ", stats.sd_stalls,
+      ", Filament: ", stats.filament / 1000, "m, Hotend: ", stats.hotend_duty, "%, Bed: ", stats.bed_duty, "%"
+    );
+  }
+}
+
+#endif // JOB_STATISTICS
@@ -0,0 +1,82 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/jobstats.h - Statistics of the last print jobs
+ *
+ * JOB_STATISTICS - @advi3++
+ *
+ * While a job is running, the main loop classifies each second as printing, heating
+ * (waiting for M109 / M190) or paused, and samples the power of the heaters. It also
+ * counts the times the planner ran out of moves with no command waiting (the input did
+ * not keep up), the serial overruns (with SERIAL_STATS_RX_BUFFER_OVERRUNS) and the SD reads
+ * that were not read ahead.
+ *
+ * At the end of a job, its statistics are written in a ring of JOB_STATISTICS_COUNT entries
+ * at the end of the EEPROM (the 128 bytes after meshes_end, not used by the settings).
+ */
+
+#include "../inc/MarlinConfig.h"
+
+struct job_stats_t {          // 28 bytes
+  uint16_t job;               // Job number, 0 for an empty entry
+  uint32_t printing,          // Time printing (s)
+           heating,           // Time waiting for the heaters (s)
+           paused;            // Time paused (s)
+  uint16_t starvations,       // The planner ran out of moves with no command waiting
+           sd_stalls;         // SD reads not read ahead
+  float    filament;          // Filament used (mm)
+  uint8_t  overruns,          // Serial RX buffer overruns (saturated), 0 without SERIAL_STATS_RX_BUFFER_OVERRUNS
+           hotend_duty,       // Average power of the hotend heater (%)
+           bed_duty;          // Average power of the bed heater (%)
+  bool     finished;          // The job finished, it was not aborted
+  uint16_t crc;
+};
+
+class JobStats {
+public:
+  static job_stats_t current;                     // The job being printed or the last one
+
+  static bool isRunning() { return running; }
+
+  static void start();
+  static void stop(const bool finished);
+  static void tick();
+
+  static bool read(uint8_t index, job_stats_t &stats); // 0 is the running job or the last one
+  static void show();
+
+private:
+  static bool running, moving;
+  static millis_t next_ms;
+  static uint32_t hotend_power, bed_power, samples;
+  #if ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS)
+    static uint8_t overruns_start;
+  #endif
+  static uint16_t sd_stalls_start;
+  static float filament_start;
+
+  static void update();
+};
+
+extern JobStats job_stats;
@@ -43,12 +43,17 @@
 
 #include "meatpack.h"
 
+#if ENABLED(MEATPACK_LOOKUP_TABLE)
+  #include "meatpack_lut.h"
+#endif
+
 #define MeatPack_ProtocolVersion "PV01"
 //#define MP_DEBUG
 
 #define DEBUG_OUT ENABLED(MP_DEBUG)
 #include "../core/debug_out.h"
 
+#if DISABLED(MEATPACK_LOOKUP_TABLE)
 // The 15 most-common characters used in G-code, ~90-95% of all G-code uses these characters
 // Stored in SRAM for performance.
 uint8_t meatPackLookupTable[16] = {
@@ -56,6 +61,7 @@ uint8_t meatPackLookupTable[16] = {
   '.', ' ', '\n', 'G', 'X',
   '\0' // Unused. 0b1111 indicates a literal character
 };
+#endif
 
 #if ENABLED(MP_DEBUG)
   uint8_t chars_decoded = 0;  // Log the first 64 bytes after each reset
@@ -74,6 +80,9 @@ void MeatPack::reset_state() {
  * Return flags indicating whether any literal bytes follow.
  */
 uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t* __restrict const chars_out) {
+  #if ENABLED(MEATPACK_LOOKUP_TABLE) // @advi3++
+    return meatpack_lut::unpack(pk, chars_out, TEST(state, MPConfig_Bit_NoSpaces));
+  #else
   uint8_t out = 0;
 
   // If lower nybble is 1111, the higher nybble is unused, and next char is full.
@@ -93,6 +102,7 @@ uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t* __restrict const chars
   }
 
   return out;
+  #endif
 }
 
 /**
@@ -157,10 +167,10 @@ void MeatPack::handle_command(const MeatPack_Command c) {
     case MPCommand_ResetAll:        reset_state();                     DEBUG_ECHOLNPGM("[MPDBG] RESET REC"); break;
     case MPCommand_EnableNoSpaces:
       SBI(state, MPConfig_Bit_NoSpaces);
-      meatPackLookupTable[kSpaceCharIdx] = kSpaceCharReplace;          DEBUG_ECHOLNPGM("[MPDBG] ENA NSP");   break;
+      IF_DISABLED(MEATPACK_LOOKUP_TABLE, meatPackLookupTable[kSpaceCharIdx] = kSpaceCharReplace); DEBUG_ECHOLNPGM("[MPDBG] ENA NSP"); break;
     case MPCommand_DisableNoSpaces:
       CBI(state, MPConfig_Bit_NoSpaces);
-      meatPackLookupTable[kSpaceCharIdx] = ' ';                        DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
+      IF_DISABLED(MEATPACK_LOOKUP_TABLE, meatPackLookupTable[kSpaceCharIdx] = ' '); DEBUG_ECHOLNPGM("[MPDBG] DIS NSP"); break;
     default:                                                           DEBUG_ECHOLNPGM("[MPDBG] UNK CMD REC");
   }
   report_state();
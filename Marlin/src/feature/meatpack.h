@@ -146,14 +146,18 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
 
   int available(serial_index_t index) {
     if (charCount) return charCount;          // The buffer still has data
-    if (out.available(index) <= 0) return 0;  // No data to read
 
     // Don't read in read method, instead do it here, so we can make progress in the read method
-    const int r = out.read(index);
-    if (r == -1) return 0;  // This is an error from the underlying serial code
-    meatpack.handle_rx_char((uint8_t)r, index);
-    charCount = meatpack.get_result_char(serialBuffer);
-    readIndex = 0;
+    // @advi3++ Bytes announcing literals and command bytes give no character: decode until some
+    // characters are available, so the queue doesn't wait for the next idle loop.
+    while (out.available(index) > 0) {
+      const int r = out.read(index);
+      if (r == -1) return 0;  // This is an error from the underlying serial code
+      meatpack.handle_rx_char((uint8_t)r, index);
+      charCount = meatpack.get_result_char(serialBuffer);
+      readIndex = 0;
+      if (charCount) break;
+    }
 
     return charCount;
   }
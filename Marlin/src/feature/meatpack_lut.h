@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * MEATPACK_LOOKUP_TABLE - @advi3++
+ *
+ * Decode a MeatPack byte with a single PROGMEM lookup instead of two nibble lookups.
+ * Each of the 256 bytes gives its two characters (low nibble first), or 0 when the
+ * character is sent as a literal in a next byte (nibble 0b1111).
+ * The table is built at compile time from the 15-character alphabet of MeatPack.
+ */
+
+#include <stdint.h>
+
+namespace meatpack_lut {
+
+  constexpr uint8_t FIRST_IS_LITERAL = 0b01, SECOND_IS_LITERAL = 0b10;
+
+  // Same alphabet as meatPackLookupTable (feature/meatpack.cpp)
+  constexpr char character(const uint8_t nibble) {
+    return nibble < 10 ? '0' + nibble
+         : nibble == 10 ? '.'
+         : nibble == 11 ? ' '
+         : nibble == 12 ? '\n'
+         : nibble == 13 ? 'G'
+         : nibble == 14 ? 'X'
+         : '\0';
+  }
+
+  #define _MP_PAIR(B) { character((B) & 0x0F), character((B) >> 4) }
+  #define _MP_ROW(H) _MP_PAIR(H * 16 +  0), _MP_PAIR(H * 16 +  1), _MP_PAIR(H * 16 +  2), _MP_PAIR(H * 16 +  3), \
+                     _MP_PAIR(H * 16 +  4), _MP_PAIR(H * 16 +  5), _MP_PAIR(H * 16 +  6), _MP_PAIR(H * 16 +  7), \
+                     _MP_PAIR(H * 16 +  8), _MP_PAIR(H * 16 +  9), _MP_PAIR(H * 16 + 10), _MP_PAIR(H * 16 + 11), \
+                     _MP_PAIR(H * 16 + 12), _MP_PAIR(H * 16 + 13), _MP_PAIR(H * 16 + 14), _MP_PAIR(H * 16 + 15)
+
+  const char table[256][2] PROGMEM = {
+    _MP_ROW(0), _MP_ROW(1), _MP_ROW(2),  _MP_ROW(3),  _MP_ROW(4),  _MP_ROW(5),  _MP_ROW(6),  _MP_ROW(7),
+    _MP_ROW(8), _MP_ROW(9), _MP_ROW(10), _MP_ROW(11), _MP_ROW(12), _MP_ROW(13), _MP_ROW(14), _MP_ROW(15)
+  };
+
+  #undef _MP_ROW
+  #undef _MP_PAIR
+
+  // Unpack the characters of a packed byte. Return the literal flags.
+  // With no_spaces, the host replaces spaces by 'E' (MPCommand_EnableNoSpaces).
+  inline uint8_t unpack(const uint8_t packed, uint8_t * const out, const bool no_spaces) {
+    const uint16_t chars = pgm_read_word(&table[packed]);
+    out[0] = uint8_t(chars);
+    out[1] = uint8_t(chars >> 8);
+    if (no_spaces) {
+      if (out[0] == ' ') out[0] = 'E';
+      if (out[1] == ' ') out[1] = 'E';
+    }
+    return (out[0] ? 0 : FIRST_IS_LITERAL) | (out[1] ? 0 : SECOND_IS_LITERAL);
+  }
+
+}
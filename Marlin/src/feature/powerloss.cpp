@@ -36,9 +36,19 @@ bool PrintJobRecovery::enabled; // Initialized by settings.load()
 MediaFile PrintJobRecovery::file;
 job_recovery_info_t PrintJobRecovery::info;
 const char PrintJobRecovery::filename[5] = "/PLR";
-uint8_t PrintJobRecovery::queue_index_r;
-uint32_t PrintJobRecovery::cmd_sdpos, // = 0
-         PrintJobRecovery::sdpos[BUFSIZE];
+#if ENABLED(PACKED_COMMAND_QUEUE) // @advi3++
+  uint32_t PrintJobRecovery::active_sdpos, // = 0
+           PrintJobRecovery::cmd_sdpos;    // = 0
+#else
+  uint8_t PrintJobRecovery::queue_index_r;
+  uint32_t PrintJobRecovery::cmd_sdpos, // = 0
+           PrintJobRecovery::sdpos[BUFSIZE];
+#endif
+#if ENABLED(BINARY_GCODE) // @advi3++
+  uint32_t PrintJobRecovery::sync_sdpos[2]; // = { 0 }
+#endif
+uint16_t PrintJobRecovery::journal_sequence, // = 0 @advi3++
+         PrintJobRecovery::header_crc;       // = 0
 
 #if HAS_DWIN_E3V2_BASIC
   bool PrintJobRecovery::dwin_flag; // = false
@@ -53,6 +63,7 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
 #include "../module/printcounter.h"
 #include "../module/temperature.h"
 #include "../core/serial.h"
+#include "../libs/crc16.h"
 
 #if HOMING_Z_WITH_PROBE
   #include "../module/probe.h"
@@ -67,6 +78,20 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
 
 PrintJobRecovery recovery;
 
+// @advi3++: Journal after the header, with records that do not cross blocks
+constexpr uint16_t PLR_BLOCK_SIZE = 512;
+constexpr uint8_t PLR_RECORDS_PER_BLOCK = PLR_BLOCK_SIZE / sizeof(job_recovery_record_t);
+constexpr uint16_t PLR_JOURNAL_RECORDS = PLR_RECORDS_PER_BLOCK * (POWER_LOSS_JOURNAL_BLOCKS);
+constexpr uint32_t PLR_FILE_SIZE = uint32_t(PLR_BLOCK_SIZE) * (1 + (POWER_LOSS_JOURNAL_BLOCKS));
+static_assert(sizeof(job_recovery_info_t) <= PLR_BLOCK_SIZE, "job_recovery_info_t must fit in the first block of the power-loss file.");
+static_assert(PLR_RECORDS_PER_BLOCK > 0, "job_recovery_record_t must fit in a block of the power-loss file.");
+
+// Position in the file of a record of the journal
+static uint32_t record_position(const uint16_t sequence) {
+  const uint16_t i = (sequence - 1) % PLR_JOURNAL_RECORDS;
+  return uint32_t(PLR_BLOCK_SIZE) * (1 + i / PLR_RECORDS_PER_BLOCK) + (i % PLR_RECORDS_PER_BLOCK) * sizeof(job_recovery_record_t);
+}
+
 #if DISABLED(BACKUP_POWER_SUPPLY)
   #undef POWER_LOSS_RETRACT_LEN   // No retract at outage without backup power
 #endif
@@ -135,6 +160,8 @@ bool PrintJobRecovery::check() {
  */
 void PrintJobRecovery::purge() {
   init();
+  close(); // @advi3++: The file is kept open while printing
+  journal_sequence = 0;
   card.removeJobRecoveryFile();
 }
 
@@ -145,6 +172,20 @@ void PrintJobRecovery::load() {
   if (exists()) {
     open(true);
     (void)file.read(&info, sizeof(info));
+
+    // @advi3++: The most recent record of the journal is the state at the time of the power loss
+    if (info.valid()) {
+      job_recovery_record_t record;
+      uint16_t sequence = 0;
+      for (uint16_t i = 1; i <= PLR_JOURNAL_RECORDS; ++i) {
+        if (!file.seekSet(record_position(i)) || file.read(&record, sizeof(record)) != int16_t(sizeof(record))) break;
+        if (record.valid() && record.valid_head > sequence) {
+          sequence = record.valid_head;
+          memcpy(reinterpret_cast<uint8_t*>(&info) + PLR_STATE_OFFSET, record.state, PLR_STATE_SIZE);
+        }
+      }
+    }
+
     close();
   }
   debug(F("Load"));
@@ -156,6 +197,8 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilenameInCWD(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  close(); // @advi3++: Start a new journal
+  journal_sequence = 0;
 }
 
 /**
@@ -245,6 +288,15 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     info.flag.dryrun = !!(marlin_debug_flags & MARLIN_DEBUG_DRYRUN);
     info.flag.allow_cold_extrusion = TERN0(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude);
 
+    #if ENABLED(BINARY_GCODE)
+      // @advi3++: The last synchronization before sdpos. The queued commands and the planned moves are far less
+      // than the commands between two synchronizations, otherwise the binary file is decoded from its start.
+      const uint32_t pos = info.sdpos;
+      info.resync_sdpos = !sync_sdpos[0] || pos >= sync_sdpos[0] ? sync_sdpos[0]
+                        : sync_sdpos[1] && pos >= sync_sdpos[1] ? sync_sdpos[1]
+                        : BinaryGCode::MAGIC_SIZE;
+    #endif
+
     write();
   }
 }
@@ -337,16 +389,47 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
 
 /**
  * Save the recovery info the recovery file
+ *
+ * @advi3++: The header is written (and the file preallocated) at the first save of a print and
+ * when the fields before current_position change. Otherwise, only a record is appended to the journal.
  */
 void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
+  // The sequence numbers are increasing in the journal, start a new one before they wrap
+  if (journal_sequence == 0xFFFF) { close(); journal_sequence = 0; }
+
   open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  if (!file.isOpen()) return;
+
+  job_recovery_record_t record;
+  memset(&record, 0, sizeof(record));
+
+  uint16_t crc = 0;
+  crc16(&crc, reinterpret_cast<const uint8_t*>(&info) + 1, PLR_STATE_OFFSET - 1); // After valid_head
+
+  if (!journal_sequence || crc != header_crc) {
+    file.seekSet(0);
+    if (file.write(&info, sizeof(info)) == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+
+    // Preallocate the file with an empty journal
+    if (!journal_sequence)
+      for (uint32_t pos = sizeof(info); pos < PLR_FILE_SIZE; pos += sizeof(record))
+        if (file.write(&record, _MIN(sizeof(record), PLR_FILE_SIZE - pos)) == -1) { DEBUG_ECHOLNPGM("Power-loss file write failed."); break; }
+
+    header_crc = crc;
+  }
+
+  // Append a record with the state, copied while the Stepper ISR does not update it
+  record.valid_head = record.valid_foot = ++journal_sequence;
+  CRITICAL_SECTION_START();
+  memcpy(record.state, reinterpret_cast<const uint8_t*>(&info) + PLR_STATE_OFFSET, PLR_STATE_SIZE);
+  CRITICAL_SECTION_END();
+
+  file.seekSet(record_position(journal_sequence));
+  if (file.write(&record, sizeof(record)) == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+  if (!file.sync()) DEBUG_ECHOLNPGM("Power-loss file sync failed.");
 }
 
 /**
@@ -599,6 +682,14 @@ void PrintJobRecovery::resume() {
   // Resume the SD file from the last position
   sprintf_P(cmd, M23_STR, &info.sd_filename[0]);
   PROCESS_SUBCOMMANDS_NOW(cmd);
+  #if ENABLED(BINARY_GCODE)
+    // @advi3++: A binary file is decoded from a synchronization, the commands before resume_sdpos are skipped
+    if (info.resync_sdpos) {
+      queue.resume_binary(info.resync_sdpos, resume_sdpos);
+      sprintf_P(cmd, PSTR("M24S%ldT%ld"), info.resync_sdpos, info.print_job_elapsed);
+    }
+    else
+  #endif
   sprintf_P(cmd, PSTR("M24S%ldT%ld"), resume_sdpos, info.print_job_elapsed);
   PROCESS_SUBCOMMANDS_NOW(cmd);
 }
@@ -698,6 +789,9 @@ void PrintJobRecovery::resume() {
 
         DEBUG_ECHOLNPGM("sd_filename: ", info.sd_filename);
         DEBUG_ECHOLNPGM("sdpos: ", info.sdpos);
+        #if ENABLED(BINARY_GCODE)
+          DEBUG_ECHOLNPGM("resync_sdpos: ", info.resync_sdpos); // @advi3++
+        #endif
         DEBUG_ECHOLNPGM("print_job_elapsed: ", info.print_job_elapsed);
 
         DEBUG_ECHOPGM("axis_relative:");
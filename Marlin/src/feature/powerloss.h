@@ -30,6 +30,8 @@
 
 #include "../inc/MarlinConfig.h"
 
+#include <stddef.h>
+
 #if ENABLED(GCODE_REPEAT_MARKERS)
   #include "../feature/repeat.h"
 #endif
@@ -53,12 +55,6 @@
 typedef struct {
   uint8_t valid_head;
 
-  // Machine state
-  xyze_pos_t current_position;
-  uint16_t feedrate;
-
-  float zraise;
-
   // Repeat information
   #if ENABLED(GCODE_REPEAT_MARKERS)
     Repeat stored_repeat;
@@ -78,16 +74,6 @@ typedef struct {
     float filament_size[EXTRUDERS];
   #endif
 
-  #if HAS_HOTEND
-    celsius_t target_temperature[HOTENDS];
-  #endif
-  #if HAS_HEATED_BED
-    celsius_t target_temperature_bed;
-  #endif
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
-  #endif
-
   #if HAS_LEVELING
     float fade;
   #endif
@@ -105,9 +91,32 @@ typedef struct {
     #endif
   #endif
 
-  // SD Filename and position
+  // SD Filename
   char sd_filename[MAXPATHNAMELENGTH];
+
+  // @advi3++: The state from here to valid_foot changes while printing and is also in the records of the journal
+
+  // Machine state
+  xyze_pos_t current_position;
+  uint16_t feedrate;
+
+  float zraise;
+
+  #if HAS_HOTEND
+    celsius_t target_temperature[HOTENDS];
+  #endif
+  #if HAS_HEATED_BED
+    celsius_t target_temperature_bed;
+  #endif
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  // SD position
   volatile uint32_t sdpos;
+  #if ENABLED(BINARY_GCODE)
+    uint32_t resync_sdpos;        // Where the decoder of a binary file restarts to resume at sdpos (0 for text files) @advi3++
+  #endif
 
   // Job elapsed time
   millis_t print_job_elapsed;
@@ -134,6 +143,31 @@ typedef struct {
 
 } job_recovery_info_t;
 
+/**
+ * @advi3++: Journal of the power-loss file
+ *
+ * Saving the whole job_recovery_info_t means opening, truncating, writing and closing the file,
+ * i.e. several reads and writes of the directory, of the FAT and of the data that stall SD printing.
+ * The file is now kept open while printing and preallocated: the header (job_recovery_info_t) is only
+ * written when the fields before current_position change and each save appends a small record with
+ * the rest, one block read and one block write. The records fill POWER_LOSS_JOURNAL_BLOCKS blocks in
+ * sequence, so a block damaged by a power loss while it is written still leaves the previous ones.
+ */
+#ifndef POWER_LOSS_JOURNAL_BLOCKS
+  #define POWER_LOSS_JOURNAL_BLOCKS 4
+#endif
+
+constexpr size_t PLR_STATE_OFFSET = offsetof(job_recovery_info_t, current_position),
+                 PLR_STATE_SIZE = offsetof(job_recovery_info_t, valid_foot) - PLR_STATE_OFFSET;
+
+typedef struct {
+  uint16_t valid_head;            // Sequence number of the record in the journal
+  uint8_t state[PLR_STATE_SIZE];  // job_recovery_info_t from current_position to valid_foot
+  uint16_t valid_foot;
+
+  bool valid() const { return valid_head && valid_head == valid_foot; }
+} job_recovery_record_t;
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -141,9 +175,20 @@ class PrintJobRecovery {
     static MediaFile file;
     static job_recovery_info_t info;
 
-    static uint8_t queue_index_r;     //!< Queue index of the active command
-    static uint32_t cmd_sdpos,        //!< SD position of the next command
-                    sdpos[BUFSIZE];   //!< SD positions of queued commands
+    #if ENABLED(PACKED_COMMAND_QUEUE) // @advi3++: The SD position is stored with each queued command
+      static uint32_t active_sdpos,   //!< SD position of the active command
+                      cmd_sdpos;      //!< SD position of the next command
+    #else
+      static uint8_t queue_index_r;   //!< Queue index of the active command
+      static uint32_t cmd_sdpos,      //!< SD position of the next command
+                      sdpos[BUFSIZE]; //!< SD positions of queued commands
+    #endif
+
+    #if ENABLED(BINARY_GCODE)
+      static uint32_t sync_sdpos[2];  //!< Positions after the last two synchronizations of a binary file @advi3++
+      //! A binary file can be decoded from sdpos, 0 at the start of a file @advi3++
+      static void sync_binary(const uint32_t sdpos) { sync_sdpos[1] = sdpos ? sync_sdpos[0] : 0; sync_sdpos[0] = sdpos; }
+    #endif
 
     #if HAS_DWIN_E3V2_BASIC
       static bool dwin_flag;
@@ -168,8 +213,12 @@ class PrintJobRecovery {
     }
 
     // Track each command's file offsets
-    static uint32_t command_sdpos() { return sdpos[queue_index_r]; }
-    static void commit_sdpos(const uint8_t index_w) { sdpos[index_w] = cmd_sdpos; }
+    #if ENABLED(PACKED_COMMAND_QUEUE) // @advi3++
+      static uint32_t command_sdpos() { return active_sdpos; }
+    #else
+      static uint32_t command_sdpos() { return sdpos[queue_index_r]; }
+      static void commit_sdpos(const uint8_t index_w) { sdpos[index_w] = cmd_sdpos; }
+    #endif
 
     static bool enabled;
     static void enable(const bool onoff);
@@ -213,6 +262,9 @@ class PrintJobRecovery {
     #endif
 
   private:
+    static uint16_t journal_sequence; //!< Sequence number of the last record, 0 before the header is written @advi3++
+    static uint16_t header_crc;       //!< CRC of the header when it was written @advi3++
+
     static void write();
 
     #if ENABLED(BACKUP_POWER_SUPPLY)
@@ -35,6 +35,13 @@
 #include "../../../module/probe.h"
 #include "../../queue.h"
 
+#if ENABLED(BED_TEMP_Z_COMPENSATION)
+  #include "../../../module/temperature.h" // @advi3++
+#endif
+#if ALL(G29_FAST_PROBING, BLTOUCH)
+  #include "../../../feature/bltouch.h" // @advi3++
+#endif
+
 #if ENABLED(AUTO_BED_LEVELING_LINEAR)
   #include "../../../libs/least_squares_fit.h"
 #endif
@@ -150,6 +157,41 @@ public:
   constexpr grid_count_t G29_State::abl_points;
 #endif
 
+// @advi3++
+#if ENABLED(G29_FAST_PROBING)
+
+  /**
+   * Move above the next point of the zigzag. The Z raise and the XY travel are queued together.
+   * The nozzle is raised G29_FAST_CLEARANCE above the highest measured point around the next one
+   * (this point and the one of the previous row), plus the slope from the previous point of the row.
+   */
+  static void move_to_next_point(const G29_State &abl, const int8_t inInc, const int8_t inStop, const_float_t previous_z) {
+    int8_t outer = PR_OUTER_VAR, inner = PR_INNER_VAR + inInc;
+    if (inner == inStop) { ++outer; inner -= inInc; } // Same column of the next row
+    if (outer >= PR_OUTER_SIZE) return;
+
+    #if ENABLED(PROBE_Y_FIRST)
+      const xy_int8_t next = { outer, inner }, around = { int8_t(outer - 1), inner };
+    #else
+      const xy_int8_t next = { inner, outer }, around = { inner, int8_t(outer - 1) };
+    #endif
+
+    const float z = abl.z_values[abl.meshCount.x][abl.meshCount.y];
+    float highest = z;
+    if (outer > 0) NOLESS(highest, abl.z_values[around.x][around.y]);
+    if (!isnan(previous_z)) highest += ABS(z - previous_z);
+
+    // Measured Z (of the probe) to Z of the nozzle
+    float next_z = highest - abl.Z_offset - probe.offset.z + (G29_FAST_CLEARANCE);
+    LIMIT(next_z, current_position.z + (G29_FAST_CLEARANCE), current_position.z + (Z_CLEARANCE_BETWEEN_PROBES));
+
+    const xy_pos_t pos = abl.probe_position_lf + abl.gridSpacing * next.asFloat();
+    if (probe.can_reach(pos))
+      do_blocking_move_to(xyz_pos_t({ pos.x - probe.offset_xy.x, pos.y - probe.offset_xy.y, next_z }));
+  }
+
+#endif
+
 /**
  * G29: Detailed Z probe, probes the bed at 3 or more points.
  *      Will fail if the printer has not been homed with G28.
@@ -664,6 +706,12 @@ G29_TYPE GcodeSuite::G29() {
   {
     const ProbePtRaise raise_after = parser.boolval('E') ? PROBE_PT_STOW : PROBE_PT_RAISE;
 
+    // @advi3++: Keep the probe deployed and move to the next point at once.
+    // A BLTouch has to be in high speed mode already (M401 S1 or the LCD), it is not forced.
+    #if ENABLED(G29_FAST_PROBING)
+      const bool fast = !faux && raise_after == PROBE_PT_RAISE && TERN1(BLTOUCH, bltouch.high_speed_mode);
+    #endif
+
     abl.measured_z = 0;
 
     #if ABL_USES_GRID
@@ -692,6 +740,8 @@ G29_TYPE GcodeSuite::G29() {
         // An index to print current state
         grid_count_t pt_index = (PR_OUTER_VAR) * (PR_INNER_SIZE) + 1;
 
+        TERN_(G29_FAST_PROBING, float previous_z = NAN); // @advi3++
+
         // Inner loop is Y with PROBE_Y_FIRST enabled
         // Inner loop is X with PROBE_Y_FIRST disabled
         for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
@@ -714,7 +764,7 @@ G29_TYPE GcodeSuite::G29() {
             break;
           }
 
-          abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
+          abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, TERN0(G29_FAST_PROBING, fast) ? PROBE_PT_NONE : raise_after, abl.verbose_level); // @advi3++
 
           if (isnan(abl.measured_z)) {
             set_bed_leveling_enabled(abl.reenable);
@@ -737,6 +787,12 @@ G29_TYPE GcodeSuite::G29() {
             abl.z_values[abl.meshCount.x][abl.meshCount.y] = z;
             TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
 
+            // @advi3++
+            #if ENABLED(G29_FAST_PROBING)
+              if (fast) move_to_next_point(abl, inInc, inStop, previous_z);
+              previous_z = z;
+            #endif
+
           #endif
 
           abl.reenable = false; // Don't re-enable after modifying the mesh
@@ -812,6 +868,7 @@ G29_TYPE GcodeSuite::G29() {
         COPY(bedlevel.z_values, abl.z_values);
         TERN_(IS_KINEMATIC, bedlevel.extrapolate_unprobed_bed_level());
         bedlevel.refresh_bed_level();
+        TERN_(BED_TEMP_Z_COMPENSATION, bedlevel.temp_z.set_mesh_temp(thermalManager.degTargetBed())); // @advi3++
 
         bedlevel.print_leveling_grid();
       }
@@ -0,0 +1,178 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * M424.cpp - Bilinear mesh slots - @advi3++
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if HAS_BILINEAR_MESH_SLOTS
+
+#include "../../gcode.h"
+#include "../../../feature/bedlevel/bedlevel.h"
+#include "../../../module/motion.h"
+#include "../../../module/planner.h"
+#include "../../../module/probe.h"
+#include "../../../module/settings.h"
+#include "../../../module/temperature.h"
+
+/**
+ * Slot of the mesh probed at the closest bed temperature. If there is none within
+ * MESH_SLOT_TEMP_RANGE, the slot to use to store a new mesh: an empty one or else
+ * the one with the farthest temperature.
+ */
+static int8_t find_slot(const celsius_t temp, bool &found) {
+  const int8_t count = settings.calc_num_meshes();
+  int8_t closest = -1, empty = -1, farthest = 0;
+  celsius_t closest_delta = 0, farthest_delta = -1;
+  LevelingBilinear::mesh_slot_t mesh;
+  for (int8_t slot = 0; slot < count; ++slot) {
+    if (!settings.load_mesh(slot, &mesh)) {
+      if (empty < 0) empty = slot;
+      continue;
+    }
+    const celsius_t delta = ABS(mesh.bed_temp - temp);
+    if (closest < 0 || delta < closest_delta) { closest = slot; closest_delta = delta; }
+    if (delta > farthest_delta) { farthest = slot; farthest_delta = delta; }
+  }
+  found = closest >= 0 && closest_delta <= (MESH_SLOT_TEMP_RANGE);
+  return found ? closest : empty >= 0 ? empty : farthest;
+}
+
+static bool load_slot(const int8_t slot) {
+  set_bed_leveling_enabled(false);
+  const bool loaded = settings.load_mesh(slot);
+  if (!loaded) SERIAL_ECHOLNPGM("?No mesh in slot ", slot, ".");
+  set_bed_leveling_enabled(loaded);
+  return loaded;
+}
+
+/**
+ * Probe 3 points of the grid (front corners and back middle) and compare them with the mesh.
+ */
+static bool check_mesh() {
+  if (homing_needed_error() || !leveling_is_valid()) return false;
+
+  constexpr uint8_t points_x[] = { 0, GRID_MAX_POINTS_X - 1, GRID_MAX_POINTS_X / 2 },
+                    points_y[] = { 0, 0, GRID_MAX_POINTS_Y - 1 };
+
+  TEMPORARY_BED_LEVELING_STATE(false);
+  remember_feedrate_scaling_off();
+
+  const float z_offset = bedlevel.get_z_offset();
+  float max_delta = 0;
+  for (uint8_t i = 0; i < COUNT(points_x) && !isnan(max_delta); ++i) {
+    const uint8_t x = points_x[i], y = points_y[i];
+    const xy_pos_t pos = { bedlevel.get_mesh_x(x), bedlevel.get_mesh_y(y) };
+    const float measured_z = probe.probe_at_point(pos, i < COUNT(points_x) - 1 ? PROBE_PT_RAISE : PROBE_PT_STOW);
+    if (isnan(measured_z))
+      max_delta = NAN;
+    else
+      NOLESS(max_delta, ABS(measured_z - (bedlevel.z_values[x][y] + z_offset)));
+  }
+
+  restore_feedrate_and_scaling();
+
+  const bool valid = max_delta <= (MESH_SLOT_CHECK_TOLERANCE); // False if NAN
+  SERIAL_ECHOLNPGM("Mesh check: ", valid ? F("ok") : F("failed"), " (", max_delta, "mm)");
+  return valid;
+}
+
+static void report_slots() {
+  LevelingBilinear::mesh_slot_t mesh;
+  for (int8_t slot = 0; slot < int8_t(settings.calc_num_meshes()); ++slot) {
+    SERIAL_ECHOPGM("  Slot ", slot);
+    if (settings.load_mesh(slot, &mesh))
+      SERIAL_ECHOLNPGM(": bed ", mesh.bed_temp, "C");
+    else
+      SERIAL_ECHOLNPGM(": empty");
+  }
+}
+
+/**
+ * M424: Bilinear mesh slots, in EEPROM.
+ *  M424 [S<slot>] [L<slot>] [D<slot>] [T[temp]] [C] [A]
+ *
+ *    S<slot>   - Store the current mesh in a slot
+ *    L<slot>   - Load the mesh of a slot
+ *    D<slot>   - Delete the mesh of a slot
+ *    T[temp]   - Load the mesh probed at the closest bed temperature (default: the target of the bed)
+ *    C         - Check the current mesh by probing 3 points of the grid
+ *    A         - If there is no mesh for T or if the check fails, probe a new mesh (G29) and store it
+ *
+ *  Without parameters, report the slots.
+ *  For example, in the start G-code, once the bed is heated and the printer is homed: M424 T C A
+ */
+void GcodeSuite::M424() {
+
+  if (!settings.calc_num_meshes()) {
+    SERIAL_ECHOLNPGM("?EEPROM storage not available.");
+    return;
+  }
+
+  bool do_report = true, valid = true;
+  int8_t slot = -1;
+  celsius_t temp = thermalManager.degTargetBed();
+
+  if (parser.seenval('S')) {
+    do_report = false;
+    settings.store_mesh(parser.value_int());
+  }
+  if (parser.seenval('D')) {
+    do_report = false;
+    settings.delete_mesh(parser.value_int());
+  }
+  if (parser.seenval('L')) {
+    do_report = false;
+    valid = load_slot(parser.value_int());
+  }
+  if (parser.seen('T')) {
+    do_report = false;
+    if (parser.has_value()) temp = parser.value_celsius();
+    bool found;
+    slot = find_slot(temp, found);
+    if (found)
+      valid = load_slot(slot);
+    else {
+      SERIAL_ECHOLNPGM("No mesh for a bed at ", temp, "C");
+      valid = false;
+    }
+  }
+  if (parser.seen_test('C')) {
+    do_report = false;
+    if (valid) valid = check_mesh();
+  }
+  if (parser.seen_test('A') && !valid) {
+    do_report = false;
+    if (slot < 0) { bool found; slot = find_slot(temp, found); }
+    set_bed_leveling_enabled(false);
+    bedlevel.reset();
+    process_subcommands_now(F("G29"));
+    if (leveling_is_valid()) settings.store_mesh(slot);
+  }
+
+  if (do_report) report_slots();
+
+}
+
+#endif // HAS_BILINEAR_MESH_SLOTS
@@ -0,0 +1,143 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * M870.cpp - Bed Temperature Z Compensation - @advi3++
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(BED_TEMP_Z_COMPENSATION)
+
+#include "../../gcode.h"
+#include "../../../MarlinCore.h"
+#include "../../../feature/bedlevel/bedlevel.h"
+#include "../../../module/motion.h"
+#include "../../../module/probe.h"
+#include "../../../module/temperature.h"
+
+#if ENABLED(EXTENSIBLE_UI)
+  #include "../../../lcd/extui/ui_api.h"
+#endif
+
+/**
+ * Heat the bed to each temperature of the model and probe the center of the bed.
+ * The heights are relative to the first temperature.
+ */
+static bool calibrate_bed_temp_z() {
+  if (homing_needed_error()) return false;
+
+  const celsius_t old_target = thermalManager.degTargetBed();
+  const bool was_enabled = planner.leveling_active;
+  set_bed_leveling_enabled(false);
+  remember_feedrate_scaling_off();
+  g29_cancel = false;
+
+  BedTempZ &temp_z = bedlevel.temp_z;
+  int16_t z[BedTempZ::COUNT];
+  const xy_pos_t center = { X_CENTER, Y_CENTER };
+  float z0 = 0;
+  bool success = true;
+  for (uint8_t i = 0; success && i < BedTempZ::COUNT; ++i) {
+    const celsius_t temp = BedTempZ::temperature(i);
+    SERIAL_ECHOLNPGM("Bed temperature ", temp);
+    TERN_(EXTENSIBLE_UI, ExtUI::onBedTempZProgress(i + 1, temp));
+
+    thermalManager.setTargetBed(temp);
+    thermalManager.wait_for_bed(false);  // Heat or cool
+    if (!g29_cancel) gcode.dwell(SEC_TO_MS(BED_TEMP_Z_SETTLE));
+
+    const float measured_z = g29_cancel ? NAN : probe.probe_at_point(center, PROBE_PT_RAISE);
+    if (isnan(measured_z))
+      success = false;
+    else {
+      if (i == 0) z0 = measured_z;
+      z[i] = LROUND((measured_z - z0) * 1000);
+    }
+  }
+
+  if (success) {
+    for (uint8_t i = 0; i < BedTempZ::COUNT; ++i) temp_z.set_z(i, z[i]);
+    SERIAL_ECHOLNPGM("Bed temperature Z compensation calibrated");
+  }
+  else
+    SERIAL_ECHOLNPGM("Bed temperature Z compensation failed or aborted");
+
+  g29_cancel = false;
+  thermalManager.setTargetBed(old_target);
+  restore_feedrate_and_scaling();
+  set_bed_leveling_enabled(was_enabled);
+  probe.move_z_after_probing();
+
+  TERN_(EXTENSIBLE_UI, ExtUI::onBedTempZDone(success));
+  return success;
+}
+
+/**
+ * M870: Bed Temperature Z Compensation.
+ *  M870 [C] [R] [S<temp>] [I<index> Z<microns>]
+ *
+ *    C         - Calibrate: heat the bed to each temperature and probe its center
+ *    R         - Reset the compensation data
+ *    S<temp>   - Set the bed temperature of the mesh
+ *    I<index>  - Index of a temperature in the list
+ *    Z<int>    - Height (µm) of the bed to set at this index
+ */
+void GcodeSuite::M870() {
+
+  bool do_report = true;
+
+  if (parser.seen_test('C')) {
+    do_report = false;
+    if (calibrate_bed_temp_z()) M870_report();
+  }
+  if (parser.seen_test('R')) {
+    do_report = false;
+    bedlevel.temp_z.reset();
+  }
+  if (parser.seenval('S')) {
+    do_report = false;
+    bedlevel.temp_z.set_mesh_temp(parser.value_celsius());
+  }
+  if (parser.seenval('I')) {
+    do_report = false;
+    const int8_t i = parser.value_int();
+    if (!WITHIN(i, 0, BedTempZ::COUNT - 1))
+      SERIAL_ECHOLNPGM("?(I) out of range (0..", BedTempZ::COUNT - 1, ").");
+    else if (parser.seenval('Z'))
+      bedlevel.temp_z.set_z(i, parser.value_int());
+    else
+      SERIAL_ECHOLNPGM("?(Z) required.");
+  }
+
+  if (do_report) M870_report();
+
+}
+
+void GcodeSuite::M870_report(const bool forReplay/*=true*/) {
+  report_heading(forReplay, F("Bed Temperature Z Compensation"));
+  SERIAL_ECHOLNPGM("  M870 S", bedlevel.temp_z.mesh_temp());
+  for (uint8_t i = 0; i < BedTempZ::COUNT; ++i)
+    SERIAL_ECHOLNPGM("  M870 I", i, " Z", bedlevel.temp_z.z(i), " ; ", BedTempZ::temperature(i), "C");
+}
+
+#endif // BED_TEMP_Z_COMPENSATION
@@ -0,0 +1,295 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * BINARY_GCODE - @advi3++
+ *
+ * Pre-tokenized G-code files (.GCB) produced by buildroot/share/scripts/gcode2gcb.py.
+ *
+ * A file starts with the magic B9 'G' 'C' 'B' 01 followed by records:
+ *
+ *   00-7F  First character of an ASCII line, copied up to '\n' (comments are removed).
+ *          Used for commands with string arguments and values with too many decimals.
+ *   80-BF  Command from the common_commands table, followed by the parameters.
+ *   FE     Other command: letter, codenum (varint), subcode, followed by the parameters.
+ *   FF     Synchronization: reset the delta-coded values to 0.
+ *
+ * Parameters are a varint mask of the letters present, a varint mask of the letters with
+ * a value and the values as zigzag varints in fixed point, in alphabetical order. The bits
+ * of the masks are in the order of BinaryGCode::letters, so the most frequent letters fit
+ * in the first byte. X, Y, Z, E and F are coded as differences with their previous value.
+ * Decoding can restart after the magic or a synchronization (power-loss recovery).
+ *
+ * The decoder writes the command in the queue buffer, already tokenized for GCodeParser:
+ *
+ *   [0]     BinaryGCode::COMMAND
+ *   [1]     command letter
+ *   [2-3]   codenum
+ *   [4]     subcode
+ *   [5-8]   codebits (as in FASTER_GCODE_PARSER)
+ *   [9-12]  bits of the parameters having a value
+ *   [13-]   values as float, in alphabetical order
+ *
+ * so parsing a line is a few copies and converting a value is a division.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+class BinaryGCode {
+public:
+  enum Result : uint8_t {
+    BGC_PASS,     // Character of an ASCII line, to be handled as usual
+    BGC_BUSY,     // Character consumed
+    BGC_COMMAND,  // Character consumed and a command is decoded in the buffer
+    BGC_SYNC,     // Character consumed and the delta-coded values are 0: decoding can restart after it
+    BGC_ERROR     // Invalid data
+  };
+
+  static constexpr uint8_t COMMAND = 0x01;
+  static constexpr uint8_t HEADER_SIZE = 13;
+  static constexpr uint8_t MAGIC_SIZE = 5;
+  static constexpr uint8_t NB_LETTERS = 26;
+  static constexpr uint8_t NB_DELTAS = 5;
+  static constexpr uint8_t NB_COMMON = 29;
+
+  static constexpr uint8_t RECORD_COMMON = 0x80;
+  static constexpr uint8_t RECORD_OTHER  = 0xFE;
+  static constexpr uint8_t RECORD_SYNC   = 0xFF;
+
+  static constexpr uint8_t VARINT_MAX_SHIFT = 28; // A varint has at most 5 bytes (32 bits)
+
+  void reset() { state = S_FILE; index = 0; clear_deltas(); }
+  void resync() { state = S_RECORD; index = 0; clear_deltas(); } // After a BGC_SYNC, to resume a file
+  void set_text_file() { state = S_TEXT_FILE; }                   // To read a text file from any position
+  static bool is_binary_file(const uint8_t first) { return first == pgm_read_byte(&magic[0]); } // First byte of a file
+  Result feed(const uint8_t c, char * const buffer, const uint8_t size, const bool skip = false);
+
+  // Offsets in the decoded buffer
+  static uint8_t letter(const char *buffer) { return buffer[1]; }
+  static uint16_t codenum(const char *buffer) { uint16_t v; memcpy(&v, buffer + 2, sizeof(v)); return v; }
+  static uint8_t subcode(const char *buffer) { return buffer[4]; }
+  static uint32_t codebits(const char *buffer) { uint32_t v; memcpy(&v, buffer + 5, sizeof(v)); return v; }
+  static uint32_t valuebits(const char *buffer) { uint32_t v; memcpy(&v, buffer + 9, sizeof(v)); return v; }
+  static float value(const char *p) { float v; memcpy(&v, p, sizeof(v)); return v; }
+  static uint8_t size(const char *buffer) {
+    uint8_t size = HEADER_SIZE;
+    for (uint32_t bits = valuebits(buffer); bits; bits &= bits - 1) size += sizeof(float);
+    return size;
+  }
+
+private:
+  enum State : uint8_t { S_FILE, S_MAGIC, S_TEXT_FILE, S_RECORD, S_TEXT, S_LETTER, S_CODENUM, S_SUBCODE, S_PRESENT, S_VALUED, S_VALUE };
+
+  static const uint8_t magic[MAGIC_SIZE];
+  static const char letters[NB_LETTERS];
+  static const uint8_t decimals[NB_LETTERS];
+  static const uint16_t common_commands[NB_COMMON];
+  static const float scales[6];
+
+  bool varint(const uint8_t c);
+  Result start_values(char * const buffer);
+  bool next_value();
+  static int8_t delta_index(const uint8_t l);
+  void clear_deltas() { for (uint8_t i = 0; i < NB_DELTAS; ++i) deltas[i] = 0; }
+
+  State state = S_FILE;
+  uint8_t index = 0;            // Position in the magic or current letter (0 = 'A')
+  uint8_t shift = 0;            // Varint decoding
+  uint8_t pos = 0;              // Position in the buffer
+  uint32_t acc = 0;             // Varint decoding
+  uint32_t present = 0, valued = 0;
+  int32_t deltas[NB_DELTAS] = {};
+};
+
+// Encoded as (letter << 14) | codenum with letter: 0 = G, 1 = M, 2 = T.
+// Keep in sync with COMMON_COMMANDS in buildroot/share/scripts/gcode2gcb.py
+inline const uint16_t BinaryGCode::common_commands[NB_COMMON] PROGMEM = {
+  0x0000 | 0,   0x0000 | 1,   0x0000 | 2,   0x0000 | 3,   0x0000 | 4,   0x0000 | 10,  0x0000 | 11,  0x0000 | 28,
+  0x0000 | 29,  0x0000 | 90,  0x0000 | 91,  0x0000 | 92,  0x4000 | 73,  0x4000 | 82,  0x4000 | 83,  0x4000 | 84,
+  0x4000 | 104, 0x4000 | 105, 0x4000 | 106, 0x4000 | 107, 0x4000 | 109, 0x4000 | 140, 0x4000 | 190, 0x4000 | 204,
+  0x4000 | 205, 0x4000 | 220, 0x4000 | 221, 0x4000 | 400, 0x8000 | 0
+};
+
+inline const uint8_t BinaryGCode::magic[MAGIC_SIZE] PROGMEM = { 0xB9, 'G', 'C', 'B', 0x01 };
+
+// Order of the letters in the masks, the most frequent first
+inline const char BinaryGCode::letters[NB_LETTERS] PROGMEM = {
+  'X', 'Y', 'Z', 'E', 'F', 'S', 'I', 'J', 'R', 'P', 'T', 'A', 'B',
+  'C', 'D', 'G', 'H', 'K', 'L', 'M', 'N', 'O', 'Q', 'U', 'V', 'W'
+};
+
+// Number of decimals of the values, in alphabetical order
+inline const uint8_t BinaryGCode::decimals[NB_LETTERS] PROGMEM = {
+  // A  B  C  D  E  F  G  H  I  J  K  L  M  N  O  P  Q  R  S  T  U  V  W  X  Y  Z
+     3, 3, 3, 3, 5, 1, 3, 3, 4, 4, 3, 3, 3, 3, 3, 2, 3, 4, 2, 0, 3, 3, 3, 3, 3, 3
+};
+
+// Divisors and not multipliers: the result is then rounded like strtof for |value| < 2^24.
+// Above (e.g. absolute E beyond 167 mm), it is within 1 ulp, like FAST_NUMBER_PARSER beyond 7 digits.
+inline const float BinaryGCode::scales[6] PROGMEM = { 1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f, 100000.0f };
+
+// Accumulate a varint (7 bits per byte, least significant first). Return true when complete.
+inline bool BinaryGCode::varint(const uint8_t c) {
+  acc |= uint32_t(c & 0x7F) << shift;
+  if (c & 0x80) { shift += 7; return false; }
+  shift = 0;
+  return true;
+}
+
+// Move to the next letter (alphabetical order) having a value. Return false if there is none.
+inline bool BinaryGCode::next_value() {
+  while (index < NB_LETTERS && !(valued & (1UL << index))) ++index;
+  return index < NB_LETTERS;
+}
+
+// Index of the delta-coded value of a letter or -1
+inline int8_t BinaryGCode::delta_index(const uint8_t l) {
+  switch (l + 'A') {
+    case 'X': return 0;
+    case 'Y': return 1;
+    case 'Z': return 2;
+    case 'E': return 3;
+    case 'F': return 4;
+    default:  return -1;
+  }
+}
+
+// Translate the masks in the order of the parser (alphabetical) and write the header
+inline BinaryGCode::Result BinaryGCode::start_values(char * const buffer) {
+  if (valued & ~present) return BGC_ERROR;
+  uint32_t codebits = 0, valuebits = 0;
+  for (uint8_t i = 0; i < NB_LETTERS; ++i) {
+    const uint32_t bit = 1UL << (pgm_read_byte(&letters[i]) - 'A');
+    if (present & (1UL << i)) codebits |= bit;
+    if (valued & (1UL << i)) valuebits |= bit;
+  }
+  valued = valuebits;
+  memcpy(buffer + 5, &codebits, sizeof(codebits));
+  memcpy(buffer + 9, &valuebits, sizeof(valuebits));
+  pos = HEADER_SIZE;
+  index = 0;
+  if (next_value()) { state = S_VALUE; return BGC_BUSY; }
+  state = S_RECORD;
+  return BGC_COMMAND;
+}
+
+/**
+ * Decode one byte of the file. The buffer receives the tokenized command when the result is
+ * BGC_COMMAND. The buffer is only valid at this point: ASCII lines reuse it.
+ * When the command is skipped, its values are not converted to floats.
+ */
+inline BinaryGCode::Result BinaryGCode::feed(const uint8_t c, char * const buffer, const uint8_t size, const bool skip) {
+  switch (state) {
+    case S_FILE:
+      if (c != pgm_read_byte(&magic[0])) { state = S_TEXT_FILE; return BGC_PASS; }
+      state = S_MAGIC;
+      index = 1;
+      return BGC_BUSY;
+
+    case S_MAGIC:
+      if (c != pgm_read_byte(&magic[index])) return BGC_ERROR;
+      if (++index < MAGIC_SIZE) return BGC_BUSY;
+      state = S_RECORD;
+      return BGC_SYNC;
+
+    case S_TEXT_FILE:
+      return BGC_PASS;
+
+    case S_RECORD:
+      if (c < 0x80) {
+        if (c != '\n' && c != '\r') state = S_TEXT;
+        return BGC_PASS;
+      }
+      acc = 0; shift = 0;
+      buffer[0] = COMMAND;
+      buffer[4] = 0;
+      if (c == RECORD_SYNC) { clear_deltas(); return BGC_SYNC; }
+      if (c == RECORD_OTHER) { state = S_LETTER; return BGC_BUSY; }
+      if (uint8_t(c - RECORD_COMMON) >= NB_COMMON) return BGC_ERROR;
+      {
+        const uint16_t command = pgm_read_word(&common_commands[c - RECORD_COMMON]);
+        const uint16_t codenum = command & 0x3FFF;
+        buffer[1] = "GMT"[command >> 14];
+        memcpy(buffer + 2, &codenum, sizeof(codenum));
+      }
+      state = S_PRESENT;
+      return BGC_BUSY;
+
+    case S_TEXT:
+      if (c == '\n' || c == '\r') state = S_RECORD;
+      return BGC_PASS;
+
+    case S_LETTER:
+      if (c < 'A' || c > 'Z') return BGC_ERROR;
+      buffer[1] = c;
+      state = S_CODENUM;
+      return BGC_BUSY;
+
+    case S_CODENUM:
+      if (!varint(c)) return shift > VARINT_MAX_SHIFT ? BGC_ERROR : BGC_BUSY;
+      if (acc > 0xFFFF) return BGC_ERROR;
+      {
+        const uint16_t codenum = acc;
+        memcpy(buffer + 2, &codenum, sizeof(codenum));
+      }
+      acc = 0;
+      state = S_SUBCODE;
+      return BGC_BUSY;
+
+    case S_SUBCODE:
+      buffer[4] = c;
+      state = S_PRESENT;
+      return BGC_BUSY;
+
+    case S_PRESENT:
+      if (!varint(c)) return shift > VARINT_MAX_SHIFT ? BGC_ERROR : BGC_BUSY;
+      present = acc; acc = 0;
+      state = S_VALUED;
+      return BGC_BUSY;
+
+    case S_VALUED:
+      if (!varint(c)) return shift > VARINT_MAX_SHIFT ? BGC_ERROR : BGC_BUSY;
+      valued = acc; acc = 0;
+      return start_values(buffer);
+
+    case S_VALUE: {
+      if (!varint(c)) return shift > VARINT_MAX_SHIFT ? BGC_ERROR : BGC_BUSY;
+      int32_t v = int32_t(acc >> 1) ^ -int32_t(acc & 1); // Zigzag
+      acc = 0;
+      const int8_t d = delta_index(index);
+      if (d >= 0) v = deltas[d] = int32_t(uint32_t(deltas[d]) + uint32_t(v)); // Wraps on invalid data instead of overflowing
+      if (pos + sizeof(float) > size) return BGC_ERROR;
+      if (!skip) {
+        const float f = v / pgm_read_float(&scales[pgm_read_byte(&decimals[index])]);
+        memcpy(buffer + pos, &f, sizeof(f));
+      }
+      pos += sizeof(float);
+      ++index;
+      if (next_value()) return BGC_BUSY;
+      state = S_RECORD;
+      return BGC_COMMAND;
+    }
+  }
+  return BGC_ERROR;
+}
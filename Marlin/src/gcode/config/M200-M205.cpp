@@ -288,10 +288,27 @@ void GcodeSuite::M204_report(const bool forReplay/*=true*/) {
  *
  * Without CLASSIC_JERK:
  *    J(mm)          : Junction Deviation
+ *
+ * With JD_CACHE: @advi3++
+ *    C              : Report the junction deviation cache hits and misses
+ *    C0             : Reset the counters
  */
 void GcodeSuite::M205() {
   if (!parser.seen_any()) return M205_report();
 
+  #if ENABLED(JD_CACHE) // @advi3++
+    if (parser.seen('C')) {
+      if (parser.has_value() && !parser.value_bool())
+        planner.jd_cache.reset_stats();
+      else {
+        const uint32_t hits = planner.jd_cache.hits, total = hits + planner.jd_cache.misses;
+        SERIAL_ECHOLNPGM("JD cache hits:", hits, " misses:", planner.jd_cache.misses,
+                         " rate:", total ? hits * 100.0f / total : 0.0f, "%");
+      }
+      return;
+    }
+  #endif
+
   //planner.synchronize();
   if (parser.seenval(M205_MIN_SEG_TIME_PARAM)) planner.settings.min_segment_time_us = parser.value_ulong();
   if (parser.seenval('S')) planner.settings.min_feedrate_mm_s = parser.value_linear_units();
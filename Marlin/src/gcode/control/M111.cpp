@@ -24,9 +24,15 @@
 
 /**
  * M111: Set the debug level
+ *
+ *   S<flags> Debug flags
+ *   R        Reset the serial statistics (AVR) @advi3++
  */
 void GcodeSuite::M111() {
   if (parser.seenval('S')) marlin_debug_flags = parser.value_byte();
+  #if defined(__AVR__) && !defined(USBCON) // @advi3++
+    if (parser.seen_test('R')) MYSERIAL1.reset_stats();
+  #endif
 
   static PGMSTR(str_debug_1, STR_DEBUG_ECHO);
   static PGMSTR(str_debug_2, STR_DEBUG_INFO);
@@ -53,22 +59,23 @@ void GcodeSuite::M111() {
       }
     }
   }
-  else {
+  else
     SERIAL_ECHOPGM(STR_DEBUG_OFF);
-    #if !(defined(__AVR__) && defined(USBCON))
-      #if ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS)
-        SERIAL_ECHOPGM("\nBuffer Overruns: ", MYSERIAL1.buffer_overruns());
-      #endif
-      #if ENABLED(SERIAL_STATS_RX_FRAMING_ERRORS)
-        SERIAL_ECHOPGM("\nFraming Errors: ", MYSERIAL1.framing_errors());
-      #endif
-      #if ENABLED(SERIAL_STATS_DROPPED_RX)
-        SERIAL_ECHOPGM("\nDropped bytes: ", MYSERIAL1.dropped());
-      #endif
-      #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
-        SERIAL_ECHOPGM("\nMax RX Queue Size: ", MYSERIAL1.rxMaxEnqueued());
-      #endif
-    #endif // !(__AVR__ && USBCON)
-  }
+
+  // @advi3++: Always report the serial statistics
+  #if !(defined(__AVR__) && defined(USBCON))
+    #if ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS)
+      SERIAL_ECHOPGM("\nBuffer Overruns: ", MYSERIAL1.buffer_overruns());
+    #endif
+    #if ENABLED(SERIAL_STATS_RX_FRAMING_ERRORS)
+      SERIAL_ECHOPGM("\nFraming Errors: ", MYSERIAL1.framing_errors());
+    #endif
+    #if ENABLED(SERIAL_STATS_DROPPED_RX)
+      SERIAL_ECHOPGM("\nDropped bytes: ", MYSERIAL1.dropped());
+    #endif
+    #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
+      SERIAL_ECHOPGM("\nMax RX Queue Size: ", MYSERIAL1.rxMaxEnqueued());
+    #endif
+  #endif // !(__AVR__ && USBCON)
   SERIAL_EOL();
 }
@@ -880,6 +880,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 423: M423(); break;                                  // M423: Reset, modify, or report X-Twist Compensation data
       #endif
 
+      #if HAS_BILINEAR_MESH_SLOTS // @advi3++
+        case 424: M424(); break;                                  // M424: Store, load, select or check bilinear mesh slots
+      #endif
+
       #if ENABLED(BACKLASH_GCODE)
         case 425: M425(); break;                                  // M425: Tune backlash compensation
       #endif
@@ -934,6 +938,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(BUFFER_MONITORING) // @advi3++
+        case 576: M576(); break;                                  // M576: Buffer statistics
+      #endif
+
+      #if ENABLED(HOT_PATH_PROFILER) // @advi3++
+        case 577: M577(); break;                                  // M577: Profiler zones
+      #endif
+
       #if HAS_ZV_SHAPING
         case 593: M593(); break;                                  // M593: Set Input Shaping parameters
       #endif
@@ -982,6 +994,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 852: M852(); break;                                  // M852: Set Skew factors
       #endif
 
+      #if ENABLED(BED_TEMP_Z_COMPENSATION) // @advi3++
+        case 870: M870(); break;                                  // M870: Calibrate, report or set the bed temperature Z compensation
+      #endif
+
       #if HAS_PTC
         case 871: M871(); break;                                  // M871: Print/reset/clear first layer temperature offset values
       #endif
@@ -1137,10 +1153,19 @@ void GcodeSuite::process_next_command() {
 
   PORT_REDIRECT(SERIAL_PORTMASK(command.port));
 
-  TERN_(POWER_LOSS_RECOVERY, recovery.queue_index_r = queue.ring_buffer.index_r);
+  #if ENABLED(PACKED_COMMAND_QUEUE) // @advi3++
+    TERN_(POWER_LOSS_RECOVERY, recovery.active_sdpos = command.sdpos);
+  #else
+    TERN_(POWER_LOSS_RECOVERY, recovery.queue_index_r = queue.ring_buffer.index_r);
+  #endif
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
+    #if ENABLED(BINARY_GCODE) // @advi3++
+      if (uint8_t(command.buffer[0]) == BinaryGCode::COMMAND)
+        SERIAL_ECHOLN(C(BinaryGCode::letter(command.buffer)), BinaryGCode::codenum(command.buffer));
+      else
+    #endif
     SERIAL_ECHOLN(command.buffer);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPGM("slot:", queue.ring_buffer.index_r);
@@ -1149,7 +1174,11 @@ void GcodeSuite::process_next_command() {
   }
 
   // Parse the next command in the queue
-  parser.parse(command.buffer);
+  #if ENABLED(GCODE_TOKENIZER)
+    parser.parse(command.buffer, TERN(PACKED_COMMAND_QUEUE, queue.ring_buffer.peek_next_index(), command.index)); // @advi3++ Already indexed when received
+  #else
+    parser.parse(command.buffer);
+  #endif
   process_parsed_command();
 }
 
@@ -240,6 +240,7 @@
  * M420 - Enable/Disable Leveling (with current values) S1=enable S0=disable (Requires MESH_BED_LEVELING or ABL)
  * M421 - Set a single Z coordinate in the Mesh Leveling grid. X<units> Y<units> Z<units> (Requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR, or AUTO_BED_LEVELING_UBL)
  * M422 - Set Z Stepper automatic alignment position using probe. X<units> Y<units> A<axis> (Requires Z_STEPPER_AUTO_ALIGN)
+ * M424 - Store, load, select by bed temperature and check bilinear mesh slots. (Requires BILINEAR_MESH_SLOTS) @advi3++
  * M425 - Enable/Disable and tune backlash correction. (Requires BACKLASH_COMPENSATION and BACKLASH_GCODE)
  * M428 - Set the home_offset based on the current_position. Nearest edge applies. (Disabled by NO_WORKSPACE_OFFSETS or DELTA)
  * M430 - Read the system current, voltage, and power (Requires POWER_MONITOR_CURRENT, POWER_MONITOR_VOLTAGE, or POWER_MONITOR_FIXED_VOLTAGE)
@@ -259,6 +260,8 @@
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
  * M575 - Change the serial baud rate. (Requires BAUD_RATE_GCODE)
+ * M576 - Report buffer statistics or set the auto-report interval. (Requires BUFFER_MONITORING) @advi3++
+ * M577 - Report or reset the time spent in the zones of the main loop. (Requires HOT_PATH_PROFILER) @advi3++
  * M593 - Get or set input shaping parameters. (Requires INPUT_SHAPING_[XY])
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
@@ -287,6 +290,7 @@
  * M868 - Report or set position encoder module error correction threshold.
  * M869 - Report position encoder module error.
  *
+ * M870 - Calibrate/report/set the bed temperature Z compensation. (Requires BED_TEMP_Z_COMPENSATION) @advi3++
  * M871 - Print/reset/clear first layer temperature offset values. (Requires PTC_PROBE, PTC_BED, or PTC_HOTEND)
  * M876 - Handle Prompt Response. (Requires HOST_PROMPT_SUPPORT and not EMERGENCY_PARSER)
  * M900 - Get or Set Linear Advance K-factor. (Requires LIN_ADVANCE)
@@ -322,7 +326,6 @@
  * M999 - Restart after being stopped by error
  *
  * D... - Custom Development G-code. Add hooks to 'gcode_D.cpp' for developers to test features. (Requires MARLIN_DEV_MODE)
- *        D576 - Set buffer monitoring options. (Requires BUFFER_MONITORING)
  *
  *** "T" Codes ***
  *
@@ -1089,6 +1092,14 @@ private:
     static void M575();
   #endif
 
+  #if ENABLED(BUFFER_MONITORING) // @advi3++
+    static void M576();
+  #endif
+
+  #if ENABLED(HOT_PATH_PROFILER) // @advi3++
+    static void M577();
+  #endif
+
   #if HAS_ZV_SHAPING
     static void M593();
     static void M593_report(const bool forReplay=true);
@@ -1154,6 +1165,12 @@ private:
     FORCE_INLINE static void M869() { I2CPEM.M869(); }
   #endif
 
+  // @advi3++
+  #if ENABLED(BED_TEMP_Z_COMPENSATION)
+    static void M870();
+    static void M870_report(const bool forReplay=true);
+  #endif
+
   #if HAS_PTC
     static void M871();
   #endif
@@ -1230,6 +1247,10 @@ private:
     static void M423_report(const bool forReplay=true);
   #endif
 
+  #if HAS_BILINEAR_MESH_SLOTS
+    static void M424(); // @advi3++
+  #endif
+
   #if HAS_MEDIA
     static void M1001();
   #endif
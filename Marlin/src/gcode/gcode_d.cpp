@@ -26,10 +26,6 @@
 
 #include "gcode.h"
 
-#if ENABLED(BUFFER_MONITORING)
-  #include "queue.h"
-#endif
-
 #include "../module/settings.h"
 #include "../module/temperature.h"
 #include "../libs/hex_print.h"
@@ -272,31 +268,7 @@ void GcodeSuite::D(const int16_t dcode) {
 
     #endif
 
-    #if ENABLED(BUFFER_MONITORING)
-
-      /**
-       * D576: Return buffer stats or set the auto-report interval.
-       * Usage: D576 [S<seconds>]
-       *
-       * With no parameters emits the following output:
-       * "D576 P<nn> B<nn> PU<nn> PD<nn> BU<nn> BD<nn>"
-       * Where:
-       *   P : Planner buffers free
-       *   B : Command buffers free
-       *   PU: Planner buffer underruns (since the last report)
-       *   PD: Longest duration (ms) the planner buffer was empty (since the last report)
-       *   BU: Command buffer underruns (since the last report)
-       *   BD: Longest duration (ms) command buffer was empty (since the last report)
-       */
-      case 576: {
-        if (parser.seenval('S'))
-          queue.set_auto_report_interval((uint8_t)parser.value_byte());
-        else
-          queue.report_buffer_statistics();
-        break;
-      }
-
-    #endif // BUFFER_MONITORING
+    // @advi3++: D576 is M576 (BUFFER_MONITORING does not require MARLIN_DEV_MODE)
   }
 }
 
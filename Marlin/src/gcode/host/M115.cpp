@@ -105,6 +105,9 @@ void GcodeSuite::M115() {
     // SERIAL_XON_XOFF
     cap_line(F("SERIAL_XON_XOFF"), ENABLED(SERIAL_XON_XOFF));
 
+    // ADVANCED_OK (ok N<line> P<planner> B<queue>) @advi3++
+    cap_line(F("ADVANCED_OK"), ENABLED(ADVANCED_OK));
+
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(F("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER)); // TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
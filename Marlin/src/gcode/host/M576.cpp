@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(BUFFER_MONITORING)
+
+#include "../gcode.h"
+#include "../queue.h"
+
+/**
+ * M576: Return buffer stats or set the auto-report interval. @advi3++ (was D576)
+ * Usage: M576 [S<seconds>]
+ *
+ * With no parameters emits the following output:
+ * "M576 P:<nn> <nn> (<nn>) B:<nn> <nn> (<nn>)"
+ * Where, for the planner (P) and the command queue (B):
+ *   - Buffers free
+ *   - Buffer underruns (since the last report)
+ *   - Longest duration (ms) the buffer was empty (since the last report)
+ */
+void GcodeSuite::M576() {
+  if (parser.seenval('S'))
+    queue.set_auto_report_interval((uint8_t)parser.value_byte());
+  else
+    queue.report_buffer_statistics();
+}
+
+#endif // BUFFER_MONITORING
@@ -0,0 +1,46 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(HOT_PATH_PROFILER)
+
+#include "../gcode.h"
+#include "../../libs/profiler.h"
+
+/**
+ * M577: Report the time spent in the zones of the main loop. @advi3++
+ * Usage: M577 [R]
+ *
+ *   R  Reset the zones
+ *
+ * Without parameter, for each zone:
+ * "<zone>: Calls: <nn> Min: <nn> Avg: <nn> Max: <nn> (us)"
+ */
+void GcodeSuite::M577() {
+  if (parser.seen('R'))
+    Profiler::reset();
+  else
+    Profiler::report();
+}
+
+#endif // HOT_PATH_PROFILER
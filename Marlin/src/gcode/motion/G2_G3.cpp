@@ -29,6 +29,10 @@
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(ARC_INTEGER) || defined(ARC_CHORDAL_TOLERANCE)
+  #include "../../libs/int_arc.h" // @advi3++
+#endif
+
 #if ENABLED(DELTA)
   #include "../../module/delta.h"
 #elif ENABLED(SCARA)
@@ -199,7 +203,9 @@ void plan_arc(
 
   // Get the ideal segment length for the move based on settings
   const float ideal_segment_mm = (
-    #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
+    #ifdef ARC_CHORDAL_TOLERANCE // @advi3++ Length based on the chordal error, the feedrate and the minimum segment time
+      int_arc_segment_mm(radius, scaled_fr_mm_s, ARC_CHORDAL_TOLERANCE, planner.settings.min_segment_time_us, MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
+    #elif ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
       constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
     #else
       MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
@@ -259,6 +265,12 @@ void plan_arc(
                 sin_T = theta_per_segment - sq_theta_per_segment * theta_per_segment / 6,
                 cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
 
+    #if ENABLED(ARC_INTEGER) // @advi3++
+      IntArc int_arc;
+      int_arc.start(rvec.a, rvec.b, theta_per_segment);
+      UNUSED(sin_T); UNUSED(cos_T);
+    #endif
+
     #if DISABLED(AUTO_BED_LEVELING_UBL)
       ARC_LIJKUVW_CODE(
         const float per_segment_L = travel_L / segments,
@@ -313,10 +325,16 @@ void plan_arc(
 
       #if N_ARC_CORRECTION > 1
         if (--arc_recalc_count) {
+          #if ENABLED(ARC_INTEGER) // @advi3++
+            int_arc.next();
+            rvec.a = int_arc.a();
+            rvec.b = int_arc.b();
+          #else
           // Apply vector rotation matrix to previous rvec.a / 1
           const float r_new_Y = rvec.a * sin_T + rvec.b * cos_T;
           rvec.a = rvec.a * cos_T - rvec.b * sin_T;
           rvec.b = r_new_Y;
+          #endif
         }
         else
       #endif
@@ -332,6 +350,7 @@ void plan_arc(
         const float Ti = i * theta_per_segment, cos_Ti = cos(Ti), sin_Ti = sin(Ti);
         rvec.a = -offset[0] * cos_Ti + offset[1] * sin_Ti;
         rvec.b = -offset[0] * sin_Ti - offset[1] * cos_Ti;
+        TERN_(ARC_INTEGER, int_arc.set(rvec.a, rvec.b)); // @advi3++
       }
 
       // Update raw location
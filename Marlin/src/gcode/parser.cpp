@@ -58,6 +58,10 @@ uint16_t GCodeParser::codenum;
   #endif
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  bool GCodeParser::binary;
+#endif
+
 #if ENABLED(FASTER_GCODE_PARSER)
   // Optimized Parameters
   uint32_t GCodeParser::codebits;  // found bits
@@ -114,6 +118,11 @@ void GCodeParser::parse(char *p) {
 
   reset(); // No codes to report
 
+  #if ENABLED(BINARY_GCODE)
+    binary = (uint8_t(*p) == BinaryGCode::COMMAND);
+    if (binary) return parse_binary(p);
+  #endif
+
   auto uppercase = [](char c) {
     if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')))
       c += 'A' - 'a';
@@ -369,6 +378,70 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Populate the command line state from a command decoded by BinaryGCode.
+   * Values are floats stored after the header, in alphabetical order.
+   */
+  void GCodeParser::parse_binary(char *p) {
+    command_ptr = p;
+    command_letter = BinaryGCode::letter(p);
+    codenum = BinaryGCode::codenum(p);
+    TERN_(USE_GCODE_SUBCODES, subcode = BinaryGCode::subcode(p));
+    codebits = BinaryGCode::codebits(p);
+    const uint32_t valuebits = BinaryGCode::valuebits(p);
+    uint8_t offset = BinaryGCode::HEADER_SIZE;
+    for (uint8_t i = 0; i < COUNT(param); ++i) {
+      if (!TEST32(codebits, i)) continue;
+      if (TEST32(valuebits, i)) { param[i] = offset; offset += sizeof(float); }
+      else param[i] = 0;
+    }
+  }
+
+#endif // BINARY_GCODE
+
+#if ENABLED(GCODE_TOKENIZER)
+
+  /**
+   * Populate the command line state from the index built by GCodeTokenizer
+   * while the line was received. Lines without an index are parsed as usual.
+   */
+  void GCodeParser::parse(char *p, const GCodeIndex &index) {
+    if (!index.letter) return parse(p);
+
+    reset();
+    TERN_(BINARY_GCODE, binary = false);
+
+    command_ptr = p + index.command;
+
+    // Nullify asterisk and trailing whitespace
+    if (index.star) {
+      char *starpos = command_ptr + index.star - 1;
+      while (*starpos == ' ') --starpos;
+      starpos[1] = '\0';
+    }
+
+    command_letter = index.letter;
+    codenum = index.codenum;
+    TERN_(USE_GCODE_SUBCODES, subcode = index.subcode);
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G'
+        && (codenum <= TERN(ARC_SUPPORT, 3, 1) || TERN0(BEZIER_CURVE_SUPPORT, codenum == 5) || TERN0(G38_PROBE_TARGET, codenum == 38))
+      ) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+
+    codebits = index.codebits;
+    memcpy(param, index.param, sizeof(param));
+    string_arg = index.string_arg ? command_ptr + index.string_arg : nullptr;
+  }
+
+#endif // GCODE_TOKENIZER
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
@@ -390,6 +463,9 @@ void GCodeParser::parse(char *p) {
 #endif // CNC_COORDINATE_SYSTEMS
 
 void GCodeParser::unknown_command_warning() {
+  #if ENABLED(BINARY_GCODE)
+    if (binary) { SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, C(command_letter), codenum, "\""); return; }
+  #endif
   SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
 }
 
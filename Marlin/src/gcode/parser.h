@@ -29,6 +29,23 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if ENABLED(BINARY_GCODE)
+  #include "binary_gcode.h"
+#endif
+
+#if ENABLED(GCODE_TOKENIZER)
+  #include "tokenizer.h"
+#endif
+
+#if ENABLED(FAST_NUMBER_PARSER)
+  #include "../libs/strtonum.h"
+  #define PARSE_LONG(P) fast_strtol(P)
+  #define PARSE_ULONG(P) fast_strtoul(P)
+#else
+  #define PARSE_LONG(P) strtol(P, nullptr, 10)
+  #define PARSE_ULONG(P) strtoul(P, nullptr, 10)
+#endif
+
 //#define DEBUG_GCODE_PARSER
 #if ENABLED(DEBUG_GCODE_PARSER)
   #include "../libs/hex_print.h"
@@ -97,6 +114,10 @@ public:
     FORCE_INLINE static void cancel_motion_mode() { motion_mode_codenum = -1; }
   #endif
 
+  #if ENABLED(BINARY_GCODE)
+    static bool binary;                   // The command is tokenized by BinaryGCode, values are floats
+  #endif
+
   #if ENABLED(DEBUG_GCODE_PARSER)
     static void debug();
   #endif
@@ -149,7 +170,7 @@ public:
       if (b) {
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = valid_number(ptr) ? ptr : nullptr;
+          value_ptr = (TERN0(BINARY_GCODE, binary) || valid_number(ptr)) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -237,6 +258,16 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if ENABLED(BINARY_GCODE)
+    // Populate all fields from a command decoded by BinaryGCode
+    static void parse_binary(char * p);
+  #endif
+
+  #if ENABLED(GCODE_TOKENIZER)
+    // Populate all fields from the index built by GCodeTokenizer, or parse the line if there is none
+    static void parse(char * p, const GCodeIndex &index);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -257,24 +288,36 @@ public:
   // Float removes 'E' to prevent scientific notation interpretation
   static float value_float() {
     if (!value_ptr) return 0;
-    char *e = value_ptr;
-    for (;;) {
-      const char c = *e;
-      if (c == '\0' || c == ' ') break;
-      if (c == 'E' || c == 'e' || c == 'X' || c == 'x') {
-        *e = '\0';
-        const float ret = strtof(value_ptr, nullptr);
-        *e = c;
-        return ret;
+    #if ENABLED(BINARY_GCODE)
+      if (binary) return BinaryGCode::value(value_ptr);
+    #endif
+    #if ENABLED(FAST_NUMBER_PARSER)
+      return fast_strtof(value_ptr); // No exponent, stops at 'E' and 'X'
+    #else
+      char *e = value_ptr;
+      for (;;) {
+        const char c = *e;
+        if (c == '\0' || c == ' ') break;
+        if (c == 'E' || c == 'e' || c == 'X' || c == 'x') {
+          *e = '\0';
+          const float ret = strtof(value_ptr, nullptr);
+          *e = c;
+          return ret;
+        }
+        ++e;
       }
-      ++e;
-    }
-    return strtof(value_ptr, nullptr);
+      return strtof(value_ptr, nullptr);
+    #endif
   }
 
   // Code value as a long or ulong
-  static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #if ENABLED(BINARY_GCODE)
+    static int32_t value_long() { return value_ptr ? binary ? (int32_t)BinaryGCode::value(value_ptr) : PARSE_LONG(value_ptr) : 0L; }
+    static uint32_t value_ulong() { return value_ptr ? binary ? (uint32_t)(int32_t)BinaryGCode::value(value_ptr) : PARSE_ULONG(value_ptr) : 0UL; }
+  #else
+    static int32_t value_long() { return value_ptr ? PARSE_LONG(value_ptr) : 0L; }
+    static uint32_t value_ulong() { return value_ptr ? PARSE_ULONG(value_ptr) : 0UL; }
+  #endif
 
   // Code value for use as time
   static millis_t value_millis() { return value_ulong(); }
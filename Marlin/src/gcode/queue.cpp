@@ -36,6 +36,7 @@ GCodeQueue queue;
 #include "../module/temperature.h"
 #include "../MarlinCore.h"
 #include "../core/bug_on.h"
+#include "../libs/profiler.h" // @advi3++
 
 #if ENABLED(BINARY_FILE_TRANSFER)
   #include "../feature/binary_stream.h"
@@ -63,7 +64,7 @@ GCodeQueue::RingBuffer GCodeQueue::ring_buffer = { 0 };
  * Track buffer underruns
  */
 #if ENABLED(BUFFER_MONITORING)
-  uint32_t GCodeQueue::command_buffer_underruns = 0,
+  uint16_t GCodeQueue::command_buffer_underruns = 0, // @advi3++
            GCodeQueue::planner_buffer_underruns = 0;
   bool GCodeQueue::command_buffer_empty = false,
        GCodeQueue::planner_buffer_empty = false;
@@ -91,15 +92,134 @@ PGM_P GCodeQueue::injected_commands_P; // = nullptr
  */
 char GCodeQueue::injected_commands[64]; // = { 0 }
 
+#if ENABLED(PACKED_COMMAND_QUEUE) // @advi3++
+
+/**
+ * Is there room for size contiguous bytes after the last command
+ * or, if there is not enough room at the end, at the start?
+ */
+bool GCodeQueue::RingBuffer::room(const uint16_t size) const {
+  if (!length) return size <= COMMAND_QUEUE_SIZE;
+  if (index_w > index_r) return COMMAND_QUEUE_SIZE - index_w >= size || index_r >= size;
+  return index_r - index_w >= size;
+}
+
+/**
+ * The command to write, with MAX_ENTRY_SIZE bytes available. Wrap around if needed.
+ * The queue must not be full.
+ */
+GCodeQueue::CommandLine& GCodeQueue::RingBuffer::next_free_command() {
+  if (length && index_w > index_r && COMMAND_QUEUE_SIZE - index_w < MAX_ENTRY_SIZE) {
+    data[index_w] = 0; // Wrap marker for the reader
+    index_w = 0;
+  }
+  return at(index_w);
+}
+
+#if ENABLED(GCODE_TOKENIZER)
+  GCodeIndex GCodeQueue::RingBuffer::peek_next_index() const {
+    const CommandLine &command = at(index_r);
+    GCodeIndex index;
+    index.unpack(command.buffer + command.text_size);
+    return index;
+  }
+#endif
+
+/**
+ * Commit the command written in next_free_command, keeping only the bytes used.
+ */
+void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
+  OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
+  OPTARG(GCODE_TOKENIZER, const GCodeIndex *index/*=nullptr*/)
+) {
+  CommandLine &command = at(index_w);
+  command.skip_ok = skip_ok;
+  TERN_(HAS_MULTI_SERIAL, command.port = serial_ind);
+  TERN_(POWER_LOSS_RECOVERY, command.sdpos = recovery.cmd_sdpos);
+
+  #if ENABLED(BINARY_GCODE)
+    if (uint8_t(command.buffer[0]) == BinaryGCode::COMMAND)
+      command.text_size = BinaryGCode::size(command.buffer);
+    else
+  #endif
+  command.text_size = strlen(command.buffer) + 1;
+
+  uint16_t size = HEADER_SIZE + command.text_size;
+  #if ENABLED(GCODE_TOKENIZER)
+    char * const packed = command.buffer + command.text_size;
+    if (index) size += index->pack(packed, MAX_CMD_SIZE + 1 - command.text_size);
+    else { *packed = 0; ++size; }
+  #elif HAS_MULTI_EXTRUDER
+    ++size; // GCodeParser converts 'T' alone into 'T*'
+  #endif
+
+  index_w += size;
+  if (index_w >= COMMAND_QUEUE_SIZE) index_w = 0;
+  ++length;
+}
+
+/**
+ * Release the command that was read, once processed.
+ */
+void GCodeQueue::RingBuffer::advance_r() {
+  // The queue may have been cleared by the command
+  if (!length) return;
+
+  if (--length == 0) { clear(); return; } // Start again at the beginning, where there is the most room
+
+  const CommandLine &command = at(index_r);
+  index_r += HEADER_SIZE + command.text_size;
+  #if ENABLED(GCODE_TOKENIZER)
+    index_r += GCodeIndex::packed_size(command.buffer + command.text_size);
+  #elif HAS_MULTI_EXTRUDER
+    ++index_r;
+  #endif
+
+  if (index_r >= COMMAND_QUEUE_SIZE || !data[index_r]) index_r = 0; // End or wrap marker
+}
+
+/**
+ * Number of the longest commands that could still be queued.
+ */
+uint8_t GCodeQueue::RingBuffer::free_commands() const {
+  uint16_t free;
+  if (!length) free = COMMAND_QUEUE_SIZE;
+  else if (index_w > index_r) free = _MAX(COMMAND_QUEUE_SIZE - index_w, index_r);
+  else free = index_r - index_w;
+  return free / MAX_ENTRY_SIZE;
+}
+
+/**
+ * Copy a command from RAM into the main command buffer.
+ * Return true if the command was successfully added.
+ * Return false for a full buffer, or if the 'command' is a comment.
+ */
+bool GCodeQueue::RingBuffer::enqueue(const char *cmd, const bool skip_ok/*=true*/
+  OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
+  OPTARG(GCODE_TOKENIZER, const GCodeIndex *index/*=nullptr*/)
+) {
+  if (*cmd == ';' || full()) return false;
+  strcpy(next_free_command().buffer, cmd);
+  commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind) OPTARG(GCODE_TOKENIZER, index));
+  return true;
+}
+
+#else // !PACKED_COMMAND_QUEUE
+
 /**
  * Commit the accumulated G-code command to the ring buffer,
  * also setting its origin info.
  */
 void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
+  OPTARG(GCODE_TOKENIZER, const GCodeIndex *index/*=nullptr*/) // @advi3++
 ) {
   commands[index_w].skip_ok = skip_ok;
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
+  #if ENABLED(GCODE_TOKENIZER) // @advi3++
+    if (index) commands[index_w].index = *index;
+    else commands[index_w].index.letter = 0;
+  #endif
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
   advance_pos(index_w, 1);
 }
@@ -111,13 +231,16 @@ void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
  */
 bool GCodeQueue::RingBuffer::enqueue(const char *cmd, const bool skip_ok/*=true*/
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
+  OPTARG(GCODE_TOKENIZER, const GCodeIndex *index/*=nullptr*/) // @advi3++
 ) {
   if (*cmd == ';' || length >= BUFSIZE) return false;
   strcpy(commands[index_w].buffer, cmd);
-  commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
+  commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind) OPTARG(GCODE_TOKENIZER, index));
   return true;
 }
 
+#endif // PACKED_COMMAND_QUEUE
+
 /**
  * Enqueue with Serial Echo
  * Return true if the command was consumed
@@ -242,7 +365,7 @@ void GCodeQueue::RingBuffer::ok_to_send() {
     // Start counting from the last command's execution
     last_command_time = millis();
   #endif
-  CommandLine &command = commands[index_r];
+  CommandLine &command = peek_next_command(); // @advi3++
   #if HAS_MULTI_SERIAL
     const serial_index_t serial_ind = command.port;
     if (!serial_ind.valid()) return;              // Optimization here, skip processing if it's not going anywhere
@@ -257,7 +380,7 @@ void GCodeQueue::RingBuffer::ok_to_send() {
       while (NUMERIC_SIGNED(*p))
         SERIAL_CHAR(*p++);
     }
-    SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - length);
+    SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, free_commands()); // @advi3++
   #endif
   SERIAL_EOL();
 }
@@ -337,7 +460,9 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_PAREN  3
 #define PS_ESC    4
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
+  OPTARG(GCODE_TOKENIZER, GCodeTokenizer &tokenizer) // @advi3++
+) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -381,9 +506,11 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
   // Backspace erases previous characters
   if (c == 0x08) {
     if (ind) buff[--ind] = '\0';
+    TERN_(GCODE_TOKENIZER, tokenizer.invalidate()); // @advi3++
   }
   else {
     buff[ind++] = c;
+    TERN_(GCODE_TOKENIZER, tokenizer.feed(c)); // @advi3++
     if (ind >= MAX_CMD_SIZE - 1)
       sis = PS_EOL;             // Skip the rest on overflow
   }
@@ -393,9 +520,12 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
+  OPTARG(GCODE_TOKENIZER, GCodeTokenizer &tokenizer) // @advi3++
+) {
   sis = PS_NORMAL;                    // "Normal" Serial Input State
   buff[ind] = '\0';                   // Of course, I'm a Terminator.
+  TERN_(GCODE_TOKENIZER, tokenizer.end(buff, ind)); // @advi3++ Checksum, N and parameters are known
   const bool is_empty = (ind == 0);   // An empty line?
   if (is_empty)
     thermalManager.task();            // Keep sensors satisfied
@@ -464,12 +594,25 @@ void GCodeQueue::get_serial_commands() {
       if (ISEOL(serial_char)) {
 
         // Reset our state, continue if the line was empty
-        if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
+        if (process_line_done(serial.input_state, serial.line_buffer, serial.count OPTARG(GCODE_TOKENIZER, serial.tokenizer)))
           continue;
 
         char* command = serial.line_buffer;
 
         while (*command == ' ') command++;                   // Skip leading spaces
+
+        #if ENABLED(GCODE_TOKENIZER) // @advi3++ Line number and checksum computed while receiving
+          const GCodeTokenizer &tokenizer = serial.tokenizer;
+          if (tokenizer.has_N()) {
+
+            const bool M110 = tokenizer.is_command('M', 110);
+
+            long gcode_N = tokenizer.N();
+            if (M110) {
+              const char * const n2pos = strchr(command + 4, 'N');
+              if (n2pos) gcode_N = PARSE_LONG(n2pos + 1);
+            }
+        #else
         char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
 
         if (npos) {
@@ -481,7 +624,8 @@ void GCodeQueue::get_serial_commands() {
             if (n2pos) npos = n2pos;
           }
 
-          const long gcode_N = strtol(npos + 1, nullptr, 10);
+          const long gcode_N = TERN(FAST_NUMBER_PARSER, fast_strtol(npos + 1), strtol(npos + 1, nullptr, 10)); // @advi3++
+        #endif
 
           // The line number must be in the correct sequence.
           if (gcode_N != serial.last_N + 1 && !M110) {
@@ -492,15 +636,24 @@ void GCodeQueue::get_serial_commands() {
             break;
           }
 
+          #if ENABLED(GCODE_TOKENIZER) // @advi3++
+            if (tokenizer.has_checksum()) {
+              if (!tokenizer.checksum_ok()) {
+                gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+                break;
+              }
+            }
+          #else
           char *apos = strrchr(command, '*');
           if (apos) {
             uint8_t checksum = 0, count = uint8_t(apos - command);
             while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum) {
+            if (TERN(FAST_NUMBER_PARSER, fast_strtol(apos + 1), strtol(apos + 1, nullptr, 10)) != checksum) { // @advi3++
               gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
               break;
             }
           }
+          #endif
           else {
             gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
             break;
@@ -549,10 +702,10 @@ void GCodeQueue::get_serial_commands() {
         #endif
 
         // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p) OPTARG(GCODE_TOKENIZER, &serial.tokenizer.index()));
       }
       else
-        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
+        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count OPTARG(GCODE_TOKENIZER, serial.tokenizer));
 
     } // NUM_SERIAL loop
   } // queue has space, serial has data
@@ -560,6 +713,96 @@ void GCodeQueue::get_serial_commands() {
 
 #if HAS_MEDIA
 
+  #if ENABLED(BINARY_GCODE)
+    static BinaryGCode binary_gcode; // @advi3++
+    static uint32_t binary_skip_sdpos; // = 0 @advi3++ The data up to this position is decoded but not queued
+    constexpr millis_t BINARY_SKIP_MS = 50; // @advi3++ Time skipping commands before the main loop runs again
+
+    /**
+     * Positions after the last synchronizations seen in the binary file, 0 for none. @advi3++
+     * Decoding restarts from the closest one before a new position instead of the start of the file.
+     * With a synchronization every 256 commands, it covers M808 loops of up to about 750 commands.
+     */
+    constexpr uint8_t BINARY_SYNCS = 4;
+    static uint32_t binary_syncs[BINARY_SYNCS]; // = { 0 }
+    static uint8_t binary_sync_index; // = 0
+
+    static void add_binary_sync(const uint32_t sdpos) {
+      for (uint8_t i = 0; i < BINARY_SYNCS; ++i)
+        if (binary_syncs[i] == sdpos) return; // Seen again after going back in the file
+      binary_syncs[binary_sync_index] = sdpos;
+      if (++binary_sync_index >= BINARY_SYNCS) binary_sync_index = 0;
+    }
+
+    static uint32_t binary_sync_before(const uint32_t sdpos) {
+      uint32_t sync = 0;
+      for (uint8_t i = 0; i < BINARY_SYNCS; ++i)
+        if (binary_syncs[i] <= sdpos && binary_syncs[i] > sync) sync = binary_syncs[i];
+      return sync;
+    }
+
+    #if ENABLED(POWER_LOSS_RECOVERY)
+      static uint32_t binary_resync_sdpos; // = 0 @advi3++ Synchronization where a resumed file is read from
+
+      void GCodeQueue::resume_binary(const uint32_t resync_sdpos, const uint32_t sdpos) {
+        binary_resync_sdpos = resync_sdpos;
+        binary_skip_sdpos = sdpos;
+      }
+    #endif
+
+    /**
+     * The SD file was opened or its position was set (M23, M26, M24 S, M808, ...). @advi3++
+     * A binary file is only decoded from its start or after a synchronization: when resuming
+     * after a power loss, it is read from the synchronization given to resume_binary. Otherwise
+     * it is decoded from the last synchronization seen before the position, or from its start,
+     * and the commands before the position are skipped.
+     */
+    static void restart_binary_gcode() {
+      const uint32_t sdpos = card.getIndex();
+      if (card.flag.file_opened) {
+        ZERO(binary_syncs);
+        card.flag.file_opened = false;
+      }
+      binary_gcode.reset();
+      TERN_(POWER_LOSS_RECOVERY, recovery.sync_binary(0));
+
+      #if ENABLED(POWER_LOSS_RECOVERY)
+        if (sdpos && sdpos == binary_resync_sdpos) {
+          binary_gcode.resync();
+          recovery.sync_binary(sdpos);
+          binary_resync_sdpos = 0;
+          card.flag.sdpos_changed = false;
+          return;
+        }
+      #endif
+
+      binary_skip_sdpos = 0;
+      const uint32_t sync = binary_sync_before(sdpos);
+      if (sync) {
+        // Only a binary file has synchronizations
+        binary_gcode.resync();
+        TERN_(POWER_LOSS_RECOVERY, recovery.sync_binary(sync));
+        if (sdpos != sync) {
+          card.setIndex(sync);
+          binary_skip_sdpos = sdpos;
+        }
+      }
+      else if (sdpos) {
+        card.setIndex(0);
+        const int16_t first = card.get();
+        if (first >= 0 && BinaryGCode::is_binary_file(first)) {
+          card.setIndex(0);
+          binary_skip_sdpos = sdpos;
+        }
+        else {
+          binary_gcode.set_text_file(); // A text file is read from any position
+          card.setIndex(sdpos);
+        }
+      }
+      card.flag.sdpos_changed = false;
+    }
+  #endif
+
   /**
    * Get lines from the SD Card until the command buffer is full
    * or until the end of the file is reached. Because this method
@@ -568,24 +811,69 @@ void GCodeQueue::get_serial_commands() {
    */
   inline void GCodeQueue::get_sdcard_commands() {
     static uint8_t sd_input_state = PS_NORMAL;
+    #if ENABLED(GCODE_TOKENIZER)
+      static GCodeTokenizer sd_tokenizer; // @advi3++
+    #endif
 
     // Get commands if there are more in the file
     if (!IS_SD_FETCHING()) return;
 
     int sd_count = 0;
+    #if ENABLED(BINARY_GCODE) // @advi3++
+      const millis_t skip_ms = millis() + BINARY_SKIP_MS;
+    #endif
     while (!ring_buffer.full() && !card.eof()) {
+      #if ENABLED(BINARY_GCODE) // @advi3++
+        if (card.flag.sdpos_changed) restart_binary_gcode();
+      #endif
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
 
-      CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
+      CommandLine &command = ring_buffer.next_free_command(); // @advi3++
+
+      #if ENABLED(BINARY_GCODE) // @advi3++
+        // After a resume or a change of position, the data before this position is not queued
+        const bool skip = card.getIndex() <= binary_skip_sdpos;
+
+        if (n >= 0) switch (binary_gcode.feed(uint8_t(n), command.buffer, sizeof(command.buffer), skip)) {
+          case BinaryGCode::BGC_PASS:                     // ASCII line, handled below
+            if (!skip) break;
+            TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+            if (card_eof) card.fileHasFinished();
+            continue;
+
+          case BinaryGCode::BGC_COMMAND:                  // Tokenized command, commit it as is
+            if (!skip) ring_buffer.commit_command(true);
+            TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex()); // Prime Power-Loss Recovery for the NEXT command
+            if (card_eof) card.fileHasFinished();
+            if (skip && ELAPSED(millis(), skip_ms)) return; // Skip for BINARY_SKIP_MS at most, the main loop keeps running
+            continue;
+
+          case BinaryGCode::BGC_SYNC:                     // The decoder can restart after this position
+            add_binary_sync(card.getIndex());
+            TERN_(POWER_LOSS_RECOVERY, recovery.sync_binary(card.getIndex()));
+            if (card_eof) card.fileHasFinished();
+            continue;
+
+          case BinaryGCode::BGC_ERROR:
+            SERIAL_ERROR_MSG(STR_BINARY_GCODE_ERROR, card.getIndex());
+            card.abortFilePrintSoon();
+            return;
+
+          default:
+            if (card_eof) card.fileHasFinished();
+            continue;
+        }
+      #endif
+
       const char sd_char = (char)n;
       const bool is_eol = ISEOL(sd_char);
       if (is_eol || card_eof) {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
+        if (!process_line_done(sd_input_state, command.buffer, sd_count OPTARG(GCODE_TOKENIZER, sd_tokenizer))) {
 
           // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
           TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
@@ -598,7 +886,7 @@ void GCodeQueue::get_serial_commands() {
           #endif
 
           // Put the new command into the buffer (no "ok" sent)
-          ring_buffer.commit_command(true);
+          ring_buffer.commit_command(true OPTARG(HAS_MULTI_SERIAL, serial_index_t()) OPTARG(GCODE_TOKENIZER, &sd_tokenizer.index())); // @advi3++
 
           // Prime Power-Loss Recovery for the NEXT commit_command
           TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
@@ -607,8 +895,10 @@ void GCodeQueue::get_serial_commands() {
         if (card.eof()) card.fileHasFinished();         // Handle end of file reached
       }
       else
-        process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
+        process_stream_char(sd_char, sd_input_state, command.buffer, sd_count OPTARG(GCODE_TOKENIZER, sd_tokenizer));
     }
+
+    TERN_(SD_STREAM, card.prefetch()); // @advi3++ Read the next sector while the queue is full
   }
 
 #endif // HAS_MEDIA
@@ -639,6 +929,7 @@ void GCodeQueue::exhaust() {
  * Get the next command in the queue, optionally log it to SD, then dispatch it
  */
 void GCodeQueue::advance() {
+  PROFILE_ZONE(QUEUE); // @advi3++
 
   // Process immediate commands
   if (process_injected_command_P() || process_injected_command()) return;
@@ -648,7 +939,7 @@ void GCodeQueue::advance() {
     #if ENABLED(BUFFER_MONITORING)
       if (!command_buffer_empty) {
         command_buffer_empty = true;
-        command_buffer_underruns++;
+        if (!++command_buffer_underruns) --command_buffer_underruns; // @advi3++: Saturate
         command_buffer_empty_at = millis();
       }
     #endif
@@ -702,15 +993,15 @@ void GCodeQueue::advance() {
   #endif // HAS_MEDIA
 
   // The queue may be reset by a command handler or by code invoked by idle() within a handler
-  ring_buffer.advance_pos(ring_buffer.index_r, -1);
+  ring_buffer.advance_r(); // @advi3++
 }
 
 #if ENABLED(BUFFER_MONITORING)
 
   void GCodeQueue::report_buffer_statistics() {
-    SERIAL_ECHOLNPGM("D576"
+    SERIAL_ECHOLNPGM("M576" // @advi3++
       " P:", planner.moves_free(),         " ", planner_buffer_underruns, " (", max_planner_buffer_empty_duration, ")"
-      " B:", BUFSIZE - ring_buffer.length, " ", command_buffer_underruns, " (", max_command_buffer_empty_duration, ")"
+      " B:", ring_buffer.free_commands(),  " ", command_buffer_underruns, " (", max_command_buffer_empty_duration, ")" // @advi3++
     );
     command_buffer_underruns = planner_buffer_underruns = 0;
     max_command_buffer_empty_duration = max_planner_buffer_empty_duration = 0;
@@ -723,7 +1014,7 @@ void GCodeQueue::advance() {
     if (planner.movesplanned() == 0) {
       if (!planner_buffer_empty) { // the planner buffer wasn't empty, but now it is
         planner_buffer_empty = true;
-        planner_buffer_underruns++;
+        if (!++planner_buffer_underruns) --planner_buffer_underruns; // @advi3++: Saturate
         planner_buffer_empty_at = ms;
       }
     }
@@ -28,6 +28,14 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if ENABLED(GCODE_TOKENIZER)
+  #include "tokenizer.h"
+#endif
+
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #include <stddef.h>
+#endif
+
 class GCodeQueue {
 public:
   /**
@@ -43,6 +51,9 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+    #if ENABLED(GCODE_TOKENIZER)
+      GCodeTokenizer tokenizer;     //!< Checksum, line number and parameters of the current line @advi3++
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -56,12 +67,91 @@ public:
    * the main loop. The gcode.process_next_command method parses the next
    * command and hands off execution to individual handler functions.
    */
+  #if ENABLED(PACKED_COMMAND_QUEUE) // @advi3++
+
+  /**
+   * With PACKED_COMMAND_QUEUE, commands are stored back-to-back in COMMAND_QUEUE_SIZE bytes.
+   * Each one only takes its header, its characters and the packed index of GCODE_TOKENIZER.
+   * A full CommandLine is only available for the next command to write.
+   */
+  struct CommandLine {
+    uint8_t text_size;              //!< Bytes of the command, including the terminator. 0 to wrap around.
+    bool skip_ok;                   //!< Skip sending ok when command is processed?
+    #if HAS_MULTI_SERIAL
+      serial_index_t port;          //!< Serial port the command was received on
+    #endif
+    #if ENABLED(POWER_LOSS_RECOVERY)
+      uint32_t sdpos;               //!< SD position of the command
+    #endif
+    char buffer[MAX_CMD_SIZE];      //!< The command buffer, followed by the packed index
+  };
+
+  /**
+   * A handy ring buffer type
+   */
+  struct RingBuffer {
+    static constexpr uint8_t HEADER_SIZE = offsetof(CommandLine, buffer);
+    // A command being written may use all its buffer, plus the index or room for 'T*'
+    static constexpr uint16_t MAX_ENTRY_SIZE = HEADER_SIZE + MAX_CMD_SIZE + 1; // Above 255 for MAX_CMD_SIZE up to 250
+
+    uint8_t length;                 //!< Number of commands in the queue
+    uint16_t index_r,               //!< Offset of the next command to read
+             index_w;               //!< Offset of the next command to write
+    char data[COMMAND_QUEUE_SIZE];  //!< The commands
+
+    inline CommandLine& at(const uint16_t i) { return *reinterpret_cast<CommandLine*>(&data[i]); }
+    inline const CommandLine& at(const uint16_t i) const { return *reinterpret_cast<const CommandLine*>(&data[i]); }
+
+    inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, at(index_r).port); }
+
+    inline void clear() { length = 0; index_r = index_w = 0; }
+
+    bool room(const uint16_t size) const;
+
+    CommandLine& next_free_command();
+
+    void advance_r();
+
+    void commit_command(const bool skip_ok
+      OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind=serial_index_t())
+      OPTARG(GCODE_TOKENIZER, const GCodeIndex *index=nullptr)
+    );
+
+    bool enqueue(const char *cmd, const bool skip_ok=true
+      OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind=serial_index_t())
+      OPTARG(GCODE_TOKENIZER, const GCodeIndex *index=nullptr)
+    );
+
+    void ok_to_send();
+
+    uint8_t free_commands() const;
+
+    inline bool full(uint8_t cmdCount=1) const { return !room(cmdCount * MAX_ENTRY_SIZE); }
+
+    inline bool occupied() const { return length != 0; }
+
+    inline bool empty() const { return !occupied(); }
+
+    inline CommandLine& peek_next_command() { return at(index_r); }
+
+    inline char* peek_next_command_string() { return peek_next_command().buffer; }
+
+    #if ENABLED(GCODE_TOKENIZER)
+      GCodeIndex peek_next_index() const;
+    #endif
+  };
+
+  #else
+
   struct CommandLine {
     char buffer[MAX_CMD_SIZE];      //!< The command buffer
     bool skip_ok;                   //!< Skip sending ok when command is processed?
     #if HAS_MULTI_SERIAL
       serial_index_t port;          //!< Serial port the command was received on
     #endif
+    #if ENABLED(GCODE_TOKENIZER)
+      GCodeIndex index;             //!< Parameters found by the tokenizer (letter == 0 if none) @advi3++
+    #endif
   };
 
   /**
@@ -79,16 +169,24 @@ public:
 
     void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
 
+    inline CommandLine& next_free_command() { return commands[index_w]; } // @advi3++
+
+    inline void advance_r() { advance_pos(index_r, -1); } // @advi3++
+
     void commit_command(const bool skip_ok
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind=serial_index_t())
+      OPTARG(GCODE_TOKENIZER, const GCodeIndex *index=nullptr) // @advi3++
     );
 
     bool enqueue(const char *cmd, const bool skip_ok=true
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind=serial_index_t())
+      OPTARG(GCODE_TOKENIZER, const GCodeIndex *index=nullptr) // @advi3++
     );
 
     void ok_to_send();
 
+    inline uint8_t free_commands() const { return BUFSIZE - length; } // @advi3++
+
     inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
 
     inline bool occupied() const { return length != 0; }
@@ -100,6 +198,8 @@ public:
     inline char* peek_next_command_string() { return peek_next_command().buffer; }
   };
 
+  #endif // PACKED_COMMAND_QUEUE
+
   /**
    * The ring buffer of commands
    */
@@ -212,6 +312,14 @@ public:
    */
   static void set_current_line_number(long n) { serial_state[ring_buffer.command_port().index].last_N = n; }
 
+  #if ALL(BINARY_GCODE, POWER_LOSS_RECOVERY)
+    /**
+     * Resume a binary G-code file at sdpos. It is read from resync_sdpos, after a synchronization,
+     * and the commands before sdpos are only decoded to restore the delta-coded values. @advi3++
+     */
+    static void resume_binary(const uint32_t resync_sdpos, const uint32_t sdpos);
+  #endif
+
   #if ENABLED(BUFFER_MONITORING)
 
     private:
@@ -219,7 +327,7 @@ public:
     /**
      * Track buffer underruns
      */
-    static uint32_t command_buffer_underruns, planner_buffer_underruns;
+    static uint16_t command_buffer_underruns, planner_buffer_underruns; // @advi3++
     static bool command_buffer_empty, planner_buffer_empty;
     static millis_t max_command_buffer_empty_duration, max_planner_buffer_empty_duration,
                     command_buffer_empty_at, planner_buffer_empty_at;
@@ -227,7 +335,7 @@ public:
     /**
      * Report buffer statistics to the host to be able to detect buffer underruns
      *
-     * Returns "D576 " followed by:
+     * Returns "M576 " followed by: @advi3++
      *  P<uint>   Planner space remaining
      *  B<uint>   Command buffer space remaining
      *  PU<uint>  Number of planner buffer underruns since last report
@@ -29,6 +29,10 @@
 
 #include "../../MarlinCore.h" // for startOrResumeJob
 
+#if ENABLED(JOB_STATISTICS)
+  #include "../../feature/jobstats.h" // @advi3++
+#endif
+
 #if ENABLED(DWIN_LCD_PROUI)
   #include "../../lcd/e3v2/proui/dwin.h"
 #endif
@@ -79,6 +83,7 @@ void GcodeSuite::M77() {
     #endif
 
     print_job_timer.showStats();
+    TERN_(JOB_STATISTICS, job_stats.show()); // @advi3++
   }
 
 #endif // PRINTCOUNTER
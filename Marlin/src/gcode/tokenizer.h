@@ -0,0 +1,426 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * GCODE_TOKENIZER - @advi3++
+ *
+ * Tokenize a G-code line in a single pass, as its characters are stored in the line buffer:
+ *
+ *  - XOR checksum of the characters before the last '*' and value after it
+ *  - Line number after a leading 'N'
+ *  - Command letter, codenum and subcode
+ *  - Parameter bits and value offsets, as built by GCodeParser::parse (FASTER_GCODE_PARSER)
+ *
+ * When the line ends, GCodeQueue checks the line number and the checksum without scanning
+ * the line again, and the index is stored with the command so GCodeParser does not scan it.
+ *
+ * Only lines of the form [N<n>] <G|M|T><code>[.<sub>] [<A-Z>[<number>]]... [*<checksum>]
+ * are indexed. Others (lowercase, quotes, commands with a string argument, ...) are parsed
+ * as usual.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+struct GCodeIndex {
+  char letter;          // Command letter, 0 if the line is not indexed
+  uint8_t command;      // Offset of the command letter in the line
+  uint8_t star;         // Offset of the first '*' from the command letter, 0 if none
+  uint8_t string_arg;   // Offset of the first parameter without a value from the command letter, 0 if none
+  uint16_t codenum;
+  uint8_t subcode;
+  uint32_t codebits;    // As GCodeParser::codebits
+  uint8_t param[26];    // As GCodeParser::param
+
+  // Packed form (PACKED_COMMAND_QUEUE): a byte of flags, the fields that are not 0, the codebits
+  // and the offsets of the parameters present. "G1 X.. Y.. E.." takes 9 bytes, 11 with N and '*'.
+  enum PackedFlags : uint8_t {
+    P_LETTER    = 0x03,   // 0: not indexed, 1: G, 2: M, 3: T
+    P_CODENUM16 = 0x04,   // codenum takes 2 bytes
+    P_COMMAND   = 0x08,   // command is present
+    P_STAR      = 0x10,   // star is present
+    P_STRING    = 0x20,   // string_arg is present
+    P_SUBCODE   = 0x40    // subcode is present
+  };
+  static constexpr uint8_t PACKED_HEADER_SIZE = 6; // Flags, codenum and codebits, without the optional fields
+  uint8_t pack(char * const dst, const uint8_t room) const;
+  void unpack(const char * const src);
+  static uint8_t packed_size(const char * const src);
+
+private:
+  static uint8_t packed_fields(const uint8_t flags) {
+    return !!(flags & P_CODENUM16) + !!(flags & P_COMMAND) + !!(flags & P_STAR) + !!(flags & P_STRING) + !!(flags & P_SUBCODE);
+  }
+};
+
+// Pack the index in room bytes (at least 1) and return the size used. Not indexed if there is not enough room.
+inline uint8_t GCodeIndex::pack(char * const dst, const uint8_t room) const {
+  uint8_t flags = letter == 'G' ? 1 : letter == 'M' ? 2 : letter == 'T' ? 3 : 0;
+  if (codenum > 0xFF) flags |= P_CODENUM16;
+  if (command) flags |= P_COMMAND;
+  if (star) flags |= P_STAR;
+  if (string_arg) flags |= P_STRING;
+  if (subcode) flags |= P_SUBCODE;
+
+  uint8_t size = PACKED_HEADER_SIZE + packed_fields(flags);
+  for (uint32_t bits = codebits; bits; bits &= bits - 1) ++size;
+  if (!(flags & P_LETTER) || size > room) { dst[0] = 0; return 1; }
+
+  char *p = dst;
+  *p++ = flags;
+  *p++ = uint8_t(codenum);
+  if (flags & P_CODENUM16) *p++ = uint8_t(codenum >> 8);
+  if (command) *p++ = command;
+  if (star) *p++ = star;
+  if (string_arg) *p++ = string_arg;
+  if (subcode) *p++ = subcode;
+  memcpy(p, &codebits, sizeof(codebits));
+  p += sizeof(codebits);
+  for (uint8_t i = 0; i < 26; ++i) if (codebits & (uint32_t(1) << i)) *p++ = param[i];
+  return size;
+}
+
+inline void GCodeIndex::unpack(const char * const src) {
+  const uint8_t flags = src[0];
+  switch (flags & P_LETTER) {
+    case 1: letter = 'G'; break;
+    case 2: letter = 'M'; break;
+    case 3: letter = 'T'; break;
+    default: letter = 0; return;
+  }
+  const char *p = src + 1;
+  codenum = uint8_t(*p++);
+  if (flags & P_CODENUM16) codenum |= uint16_t(uint8_t(*p++)) << 8;
+  command = (flags & P_COMMAND) ? *p++ : 0;
+  star = (flags & P_STAR) ? *p++ : 0;
+  string_arg = (flags & P_STRING) ? *p++ : 0;
+  subcode = (flags & P_SUBCODE) ? *p++ : 0;
+  memcpy(&codebits, p, sizeof(codebits));
+  p += sizeof(codebits);
+  for (uint8_t i = 0; i < 26; ++i) if (codebits & (uint32_t(1) << i)) param[i] = *p++;
+}
+
+inline uint8_t GCodeIndex::packed_size(const char * const src) {
+  const uint8_t flags = src[0];
+  if (!(flags & P_LETTER)) return 1;
+  const uint8_t fields = packed_fields(flags);
+  uint32_t bits;
+  memcpy(&bits, src + 2 + fields, sizeof(bits));
+  uint8_t size = PACKED_HEADER_SIZE + fields;
+  for (; bits; bits &= bits - 1) ++size;
+  return size;
+}
+
+class GCodeTokenizer {
+public:
+  void reset();
+  void feed(const char c);
+  void invalidate() { state = T_INVALID; }  // Characters were removed (backspace)
+  void end(const char * const line, const uint8_t length);
+
+  bool has_N() const { return flags & F_N; }
+  long N() const { return (flags & F_N_MINUS) ? -line_N : line_N; }
+  bool has_checksum() const { return flags & F_STAR; }
+  bool checksum_ok() const { return (flags & F_STAR) && received == checksum; }
+  bool is_command(const char l, const uint16_t code) const { return letter == l && idx.codenum == code; }
+  const GCodeIndex &index() const { return idx; }
+
+private:
+  enum State : uint8_t {
+    T_START,      // Leading spaces
+    T_N,          // Character after 'N'
+    T_N_DIGITS,   // Line number
+    T_LETTER,     // Command letter
+    T_CODE,       // First digit of codenum
+    T_CODENUM,
+    T_SUBCODE,
+    T_PARAMS,     // Parameter letter
+    T_VALUE_START,
+    T_VALUE,
+    T_DONE,       // After '*' or not indexed: only the checksum
+    T_INVALID     // Tokenized again by end()
+  };
+
+  enum ValueState : uint8_t { V_OK, V_SIGN, V_DOT, V_BAD };
+
+  enum Flags : uint8_t {
+    F_N         = 0x01,
+    F_N_MINUS   = 0x02,
+    F_STAR      = 0x04,
+    F_RECEIVED  = 0x08,   // Digits after the last '*'
+    F_INDEXED   = 0x10,
+    F_END       = 0x20
+  };
+
+  static bool is_digit(const char c) { return c >= '0' && c <= '9'; }
+  static bool is_letter(const char c) { return c >= 'A' && c <= 'Z'; }
+  static bool is_value(const char c) { return is_digit(c) || c == '.' || c == '-' || c == '+'; }
+
+  static bool is_string_command(const uint16_t code);
+  void command_done();
+  void set(const char c, const uint8_t o);
+  void no_value(const uint8_t o);
+  void check_value(const char c);
+  void tokenize(const char c, const uint8_t o);
+  void star(const uint8_t o);
+
+  State state;
+  uint8_t flags;
+  uint8_t offset;       // Offset of the next character
+  char letter;          // Command letter
+  char pending;         // Parameter letter waiting for its value
+  uint8_t pending_at;   // Offset of this letter
+  uint8_t value_at;     // Offset of its value
+  uint8_t value_state;  // Validity of this value, as GCodeParser::valid_float
+  uint8_t x;            // XOR of all the characters so far
+  uint8_t checksum;     // XOR of the characters before the last '*'
+  uint16_t received;    // Checksum after the last '*'
+  long line_N;
+  GCodeIndex idx;
+};
+
+inline void GCodeTokenizer::reset() {
+  state = T_START;
+  flags = offset = x = checksum = 0;
+  letter = pending = 0;
+  pending_at = value_at = value_state = 0;
+  received = 0;
+  line_N = 0;
+  idx.letter = 0;
+  idx.star = idx.string_arg = 0;
+  idx.codenum = 0;
+  idx.subcode = 0;
+  idx.codebits = 0;
+}
+
+// Same list as GCodeParser::parse
+inline bool GCodeTokenizer::is_string_command(const uint16_t code) {
+  switch (code) {
+    #ifdef GCODE_MACROS
+      case 810 ... 819:
+    #endif
+    #ifdef EXPECTED_PRINTER_CHECK
+      case 16:
+    #endif
+    case 23: case 28: case 30: case 32: case 117 ... 118: case 928:
+      return true;
+    default:
+      return false;
+  }
+}
+
+inline void GCodeTokenizer::command_done() {
+  if (letter == 'M' && is_string_command(idx.codenum)) state = T_DONE;
+  else { flags |= F_INDEXED; state = T_PARAMS; }
+}
+
+// Parameter letter with a value at offset o (from the line) or without value (o == 0)
+inline void GCodeTokenizer::set(const char c, const uint8_t o) {
+  const uint8_t ind = c - 'A';
+  idx.codebits |= uint32_t(1) << ind;
+  idx.param[ind] = o ? o - idx.command : 0;
+}
+
+// Parameter without a value. GCodeParser keeps the first one as string_arg (o is after the spaces)
+inline void GCodeTokenizer::no_value(const uint8_t o) {
+  set(pending, 0);
+  if (!idx.string_arg) idx.string_arg = o - 1 - idx.command;
+}
+
+// [-+]?.?[0-9] starts a value. Characters after the value are 0.
+inline void GCodeTokenizer::check_value(const char c) {
+  switch (value_state) {
+    case V_SIGN:
+      if (c == '.') { value_state = V_DOT; return; }
+      // fall-through
+    case V_DOT:
+      if (is_digit(c)) { value_state = V_OK; return; }
+      no_value(value_at);
+      value_state = V_BAD;
+      break;
+    default: break;
+  }
+}
+
+inline void GCodeTokenizer::star(const uint8_t o) {
+  switch (state) {
+    case T_CODENUM: case T_SUBCODE:
+      command_done();
+      break;
+    case T_VALUE_START:                     // GCodeParser removes the spaces before '*'
+      no_value(pending_at + 1);
+      break;
+    case T_VALUE:
+      check_value(0);
+      break;
+    case T_PARAMS:
+      break;
+    default:
+      flags &= ~F_INDEXED;
+      state = T_DONE;
+      return;
+  }
+  if (state == T_DONE) return;
+  idx.star = o - idx.command;
+  state = T_DONE;
+}
+
+inline void GCodeTokenizer::tokenize(const char c, const uint8_t o) {
+  switch (state) {
+    case T_START:
+      if (c == ' ') return;
+      if (c != 'N') { state = T_LETTER; break; }
+      flags |= F_N;
+      state = T_N;
+      return;
+
+    case T_N:
+      if (c == '-') flags |= F_N_MINUS;
+      else if (is_digit(c)) line_N = c - '0';
+      else { state = T_DONE; return; }      // Not skipped by GCodeParser
+      state = T_N_DIGITS;
+      return;
+
+    case T_N_DIGITS:
+      if (is_digit(c)) { line_N = line_N * 10 + (c - '0'); return; }
+      state = T_LETTER;
+      break;
+
+    default: break;
+  }
+
+  switch (state) {
+    case T_LETTER:
+      if (c == ' ') return;
+      if (c != 'G' && c != 'M' && c != 'T') { state = T_DONE; return; }
+      letter = c;
+      idx.command = o;
+      state = T_CODE;
+      return;
+
+    case T_CODE:
+      if (c == ' ') return;
+      if (!is_digit(c)) { state = T_DONE; return; }
+      idx.codenum = c - '0';
+      state = T_CODENUM;
+      return;
+
+    case T_CODENUM:
+      if (is_digit(c)) { idx.codenum = idx.codenum * 10 + (c - '0'); return; }
+      #if USE_GCODE_SUBCODES
+        if (c == '.') { state = T_SUBCODE; return; }
+      #endif
+      command_done();
+      break;
+
+    case T_SUBCODE:
+      if (is_digit(c)) { idx.subcode = idx.subcode * 10 + (c - '0'); return; }
+      command_done();
+      break;
+
+    default: break;
+  }
+
+  switch (state) {
+    case T_VALUE_START:
+      if (c == ' ') return;
+      if (is_value(c)) {
+        set(pending, o);
+        value_at = o;
+        value_state = is_digit(c) ? V_OK : c == '.' ? V_DOT : V_SIGN;
+        state = T_VALUE;
+        return;
+      }
+      no_value(o);
+      break;
+
+    case T_VALUE:
+      check_value(c);
+      if (is_value(c)) return;
+      break;
+
+    default: break;
+  }
+
+  switch (state) {
+    case T_PARAMS: case T_VALUE_START: case T_VALUE:
+      if (c == ' ') { state = T_PARAMS; return; }
+      if (is_letter(c)) { pending = c; pending_at = o; state = T_VALUE_START; return; }
+      flags &= ~F_INDEXED;
+      state = T_DONE;
+      return;
+
+    default: break;
+  }
+}
+
+// Character stored in the line buffer
+inline void GCodeTokenizer::feed(const char c) {
+  if (flags & F_END) reset();
+  const uint8_t o = offset++;
+  if (state == T_INVALID) return;
+
+  if (c == '*') {
+    if (state != T_DONE) star(o);
+    checksum = x;
+    received = 0;
+    flags = (flags | F_STAR) & ~F_RECEIVED;
+  }
+  else if (flags & F_STAR) {
+    if (is_digit(c)) {
+      if (received < 0x100) received = received * 10 + (c - '0');
+      flags |= F_RECEIVED;
+    }
+    else if (c != ' ' || (flags & F_RECEIVED))
+      received = 0x100;                     // Never a valid checksum
+  }
+
+  if (state == T_START && c == ' ') return; // Leading spaces are not part of the checksum
+  x ^= c;
+
+  if (state != T_DONE && c != '*') tokenize(c, o);
+}
+
+// The line is complete (length characters)
+inline void GCodeTokenizer::end(const char * const line, const uint8_t length) {
+  if (state == T_INVALID || offset != length) {
+    reset();
+    for (uint8_t i = 0; i < length; ++i) feed(line[i]);
+  }
+
+  switch (state) {
+    case T_CODENUM: case T_SUBCODE:
+      command_done();
+      break;
+    case T_VALUE_START:
+      no_value(offset);
+      break;
+    case T_VALUE:
+      check_value(0);
+      break;
+    default: break;
+  }
+
+  idx.letter = (flags & F_INDEXED) ? letter : 0;
+  flags |= F_END;
+}
@@ -3010,6 +3010,38 @@
   #define LEVELED_SEGMENT_LENGTH 5
 #endif
 
+// @advi3++: Adaptive segments only for bilinear leveling on Cartesian
+#if ENABLED(ADAPTIVE_LEVELED_SEGMENTS)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR) || IS_KINEMATIC
+    #undef ADAPTIVE_LEVELED_SEGMENTS
+  #elif !defined(LEVELED_SEGMENT_TOLERANCE)
+    #define LEVELED_SEGMENT_TOLERANCE 0.005
+  #endif
+#endif
+
+// @advi3++: Fast probing only for bilinear leveling with a probe
+#if ENABLED(G29_FAST_PROBING)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR) || ENABLED(PROBE_MANUALLY)
+    #undef G29_FAST_PROBING
+  #elif !defined(G29_FAST_CLEARANCE)
+    #define G29_FAST_CLEARANCE 2
+  #endif
+#endif
+
+// @advi3++: Mesh slots only for bilinear leveling with EEPROM
+#if defined(BILINEAR_MESH_SLOTS) && (DISABLED(AUTO_BED_LEVELING_BILINEAR) || DISABLED(EEPROM_SETTINGS) || BILINEAR_MESH_SLOTS <= 0)
+  #undef BILINEAR_MESH_SLOTS
+#endif
+#ifdef BILINEAR_MESH_SLOTS
+  #define HAS_BILINEAR_MESH_SLOTS 1
+  #ifndef MESH_SLOT_TEMP_RANGE
+    #define MESH_SLOT_TEMP_RANGE 10
+  #endif
+  #ifndef MESH_SLOT_CHECK_TOLERANCE
+    #define MESH_SLOT_CHECK_TOLERANCE 0.05
+  #endif
+#endif
+
 /**
  * Default mesh area is an area with an inset margin on the print area.
  */
@@ -840,6 +840,176 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+/**
+ * S-Curve Acceleration lookup table
+ */
+// @advi3++
+#if ENABLED(S_CURVE_TABLE) && DISABLED(S_CURVE_ACCELERATION)
+  #error "S_CURVE_TABLE requires S_CURVE_ACCELERATION."
+#endif
+
+/**
+ * Arc interpolation
+ */
+// @advi3++
+#if defined(ARC_CHORDAL_TOLERANCE) && ARC_SEGMENTS_PER_SEC
+  #error "ARC_CHORDAL_TOLERANCE and ARC_SEGMENTS_PER_SEC are incompatible."
+#elif ENABLED(ARC_INTEGER) && DISABLED(ARC_SUPPORT)
+  #error "ARC_INTEGER requires ARC_SUPPORT."
+#endif
+
+/**
+ * Junction deviation cache
+ */
+// @advi3++
+#if ENABLED(JD_CACHE)
+  #if !HAS_JUNCTION_DEVIATION
+    #error "JD_CACHE requires JUNCTION_DEVIATION_MM."
+  #elif !defined(JD_CACHE_SIZE) || JD_CACHE_SIZE < 1 || JD_CACHE_SIZE > 128 || (JD_CACHE_SIZE & (JD_CACHE_SIZE - 1))
+    #error "JD_CACHE_SIZE must be a power of 2 between 1 and 128."
+  #endif
+#endif
+
+/**
+ * SD print stream
+ */
+// @advi3++
+#if ENABLED(SD_STREAM)
+  #if !NEED_SD2CARD_SPI || ANY(USB_FLASH_DRIVE_SUPPORT, MULTI_VOLUME)
+    #error "SD_STREAM requires an SPI SD card."
+  #elif !WITHIN(SD_STREAM_BUFFERS, 1, 2)
+    #error "SD_STREAM_BUFFERS must be 1 or 2."
+  #elif !WITHIN(SD_STREAM_RUNS, 1, 16)
+    #error "SD_STREAM_RUNS must be between 1 and 16."
+  #endif
+#endif
+
+/**
+ * Binary G-code files
+ */
+// @advi3++
+#if ENABLED(BINARY_GCODE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "BINARY_GCODE requires FASTER_GCODE_PARSER."
+  #elif ENABLED(GCODE_MOTION_MODES)
+    #error "BINARY_GCODE is not compatible with GCODE_MOTION_MODES."
+  #elif MAX_CMD_SIZE > 255
+    #error "BINARY_GCODE requires MAX_CMD_SIZE <= 255."
+  #endif
+#endif
+
+/**
+ * Single-pass G-code tokenizer
+ */
+// @advi3++
+#if ENABLED(GCODE_TOKENIZER)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "GCODE_TOKENIZER requires FASTER_GCODE_PARSER."
+  #elif MAX_CMD_SIZE > 255
+    #error "GCODE_TOKENIZER requires MAX_CMD_SIZE <= 255."
+  #endif
+#endif
+
+/**
+ * Packed command queue
+ */
+// @advi3++
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #if MAX_CMD_SIZE > 250
+    #error "PACKED_COMMAND_QUEUE requires MAX_CMD_SIZE <= 250."
+  #elif COMMAND_QUEUE_SIZE < 2 * (MAX_CMD_SIZE + 4 + TERN0(POWER_LOSS_RECOVERY, 4)) || COMMAND_QUEUE_SIZE > 1000
+    #error "COMMAND_QUEUE_SIZE must be between 2 * (MAX_CMD_SIZE + 4) (+ 8 with POWER_LOSS_RECOVERY) and 1000."
+  #endif
+#endif
+
+/**
+ * Host baud rate
+ */
+// @advi3++
+#if defined(ADVi3PP_BAUDRATE) && ADVi3PP_BAUDRATE != 115200 && ADVi3PP_BAUDRATE != 250000 && ADVi3PP_BAUDRATE != 500000
+  #error "ADVi3PP_BAUDRATE must be 115200, 250000 or 500000."
+#elif BAUDRATE > 115200 && DISABLED(SERIAL_XON_XOFF)
+  #error "A BAUDRATE above 115200 requires SERIAL_XON_XOFF."
+#endif
+
+/**
+ * SD write behind
+ */
+// @advi3++
+#if ENABLED(SD_WRITE_BEHIND) && defined(SD_WRITE_TIMEOUT) && SD_WRITE_TIMEOUT == 0
+  #error "SD_WRITE_BEHIND requires SD_WRITE_TIMEOUT > 0 (commands wait for the end of the flashing)."
+#endif
+
+/**
+ * Thermistor tables and fixed-point PID
+ */
+// @advi3++
+#if ENABLED(THERMISTOR_LUT) && !WITHIN(THERMISTOR_LUT_SHIFT, 2, 8)
+  #error "THERMISTOR_LUT_SHIFT must be between 2 and 8."
+#endif
+#if ENABLED(PID_FIXED_POINT) && PID_FUNCTIONAL_RANGE > 100
+  #error "PID_FIXED_POINT requires PID_FUNCTIONAL_RANGE <= 100."
+#endif
+
+/**
+ * Adaptive leveled segments
+ */
+// @advi3++
+#if ENABLED(ADAPTIVE_LEVELED_SEGMENTS)
+  static_assert(LEVELED_SEGMENT_TOLERANCE > 0, "LEVELED_SEGMENT_TOLERANCE must be greater than 0.");
+#endif
+
+/**
+ * Fast G29 probing
+ */
+// @advi3++
+#if ENABLED(G29_FAST_PROBING)
+  static_assert(WITHIN(G29_FAST_CLEARANCE, 0.5, Z_CLEARANCE_BETWEEN_PROBES), "G29_FAST_CLEARANCE must be between 0.5 and Z_CLEARANCE_BETWEEN_PROBES.");
+#endif
+
+/**
+ * Bilinear mesh slots
+ */
+// @advi3++
+#if HAS_BILINEAR_MESH_SLOTS && !HAS_BED_PROBE
+  #error "BILINEAR_MESH_SLOTS requires a bed probe to check the meshes."
+#endif
+
+/**
+ * Bed temperature Z compensation
+ */
+// @advi3++
+#if ENABLED(BED_TEMP_Z_COMPENSATION)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR) || !HAS_BED_PROBE || !HAS_HEATED_BED
+    #error "BED_TEMP_Z_COMPENSATION requires AUTO_BED_LEVELING_BILINEAR, a bed probe and a heated bed."
+  #elif BED_TEMP_Z_COUNT < 2 || BED_TEMP_Z_RES <= 0
+    #error "BED_TEMP_Z_COMPENSATION requires BED_TEMP_Z_COUNT >= 2 and BED_TEMP_Z_RES > 0."
+  #elif BED_TEMP_Z_START + (BED_TEMP_Z_COUNT - 1) * BED_TEMP_Z_RES > BED_MAX_TARGET
+    #error "The last temperature of BED_TEMP_Z_COMPENSATION must not be above BED_MAX_TARGET."
+  #endif
+#endif
+
+/**
+ * Endstop interrupts
+ */
+// @advi3++
+#if ENABLED(ENDSTOP_INTERRUPTS_FEATURE) && MB(ADVI3PP_I3_PLUS_51, ADVI3PP_I3_PLUS_52C, ADVI3PP_I3_PLUS_54)
+  // X (PF0), Y (PA2) and Z (PA1, PA3 or PH3) have neither an external interrupt nor a pin change interrupt
+  #error "ENDSTOP_INTERRUPTS_FEATURE is not possible with the i3 Plus mainboards: their endstop pins are not interrupt-capable."
+#endif
+
+/**
+ * Job statistics
+ */
+// @advi3++
+#if ENABLED(JOB_STATISTICS)
+  #if DISABLED(PRINTCOUNTER)
+    #error "JOB_STATISTICS requires PRINTCOUNTER."
+  #elif !WITHIN(JOB_STATISTICS_COUNT, 1, 4)
+    #error "JOB_STATISTICS_COUNT must be between 1 and 4."
+  #endif
+#endif
+
 /**
  * Special tool-changing options
  */
@@ -3715,7 +3885,8 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
 /**
  * Sanity Check for MEATPACK and BINARY_FILE_TRANSFER Features
  */
-#if ALL(HAS_MEATPACK, BINARY_FILE_TRANSFER)
+// @advi3++ With a single serial port, binary packets are read without MeatPack (binary_stream.h)
+#if ALL(HAS_MEATPACK, BINARY_FILE_TRANSFER) && (HAS_MULTI_SERIAL || ENABLED(MEATPACK_ON_SERIAL_PORT_2))
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
 
@@ -1027,7 +1027,9 @@ namespace ExtUI {
       void setMeshPoint(const xy_uint8_t &pos, const_float_t zoff) {
         if (WITHIN(pos.x, 0, (GRID_MAX_POINTS_X) - 1) && WITHIN(pos.y, 0, (GRID_MAX_POINTS_Y) - 1)) {
           bedlevel.z_values[pos.x][pos.y] = zoff;
-          TERN_(ABL_BILINEAR_SUBDIVISION, bedlevel.refresh_bed_level());
+          #if EITHER(ABL_BILINEAR_SUBDIVISION, ABL_BILINEAR_COEFFICIENTS) // @advi3++
+            bedlevel.refresh_bed_level();
+          #endif
         }
       }
 
@@ -1202,7 +1204,11 @@ namespace ExtUI {
   }
   void setUserConfirmed() { TERN_(HAS_RESUME_CONTINUE, wait_for_user = false); }
 
-  void cancelLeveling() { ::g29_cancel = true; } // @advi3++
+  // @advi3++
+  void cancelLeveling() {
+    ::g29_cancel = true;
+    TERN_(BED_TEMP_Z_COMPENSATION, ::wait_for_heatup = false); // Calibration waiting for the bed
+  }
 
   #if M600_PURGE_MORE_RESUMABLE
     void setPauseMenuResponse(PauseMenuResponse response) { pause_menu_response = response; }
@@ -233,6 +233,10 @@ namespace ExtUI {
       void onLevelingDone(bool success); // @advi3++
       void onLevelingProgress(const int8_t index, const int8_t xpos, const int8_t ypos); // @advi3++
       void cancelLeveling(); // @advi3++
+      #if ENABLED(BED_TEMP_Z_COMPENSATION)
+        void onBedTempZProgress(const uint8_t index, const celsius_t temp); // @advi3++
+        void onBedTempZDone(bool success); // @advi3++
+      #endif
       void onMeshUpdate(const int8_t xpos, const int8_t ypos, const_float_t zval);
       inline void onMeshUpdate(const xy_int8_t &pos, const_float_t zval) { onMeshUpdate(pos.x, pos.y, zval); }
 
@@ -522,6 +526,8 @@ namespace ExtUI {
   void onStatusChanged(FSTR_P const fstr);
   void onShowStatus(); // @advi3++
   void onHomingStart();
+  void onHomingAxisStart(const axis_t axis); // @advi3++
+  void onHomingAxisDone(const axis_t axis, const bool success); // @advi3++
   void onHomingDone();
   void onSteppersDisabled();
   void onSteppersEnabled();
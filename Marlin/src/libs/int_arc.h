@@ -0,0 +1,89 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * ARC_INTEGER - @advi3++
+ *
+ * Integer incremental rotation of the arc radius vector for G2/G3.
+ *
+ * The radius vector is kept in Q16.16 (mm) and rotated each segment by
+ *
+ *   a' = a + a * (cos T - 1) - b * sin T
+ *   b' = b + a * sin T + b * (cos T - 1)
+ *
+ * with sin T and cos T - 1 in Q31, computed once per arc. Each rotation adds at most one ulp (15 nm)
+ * of rounding per coordinate, plus the error of the coefficients (2^-24 relative, they come from
+ * floats). After N_ARC_CORRECTION (25) segments on a 100 mm radius, the error is below 1 µm.
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+class IntArc {
+public:
+  // Radius vector (a, b) in mm, rotated by theta (rad) each segment
+  void start(const float a, const float b, const float theta) {
+    set(a, b);
+    const float half = sinf(theta * 0.5f);
+    sin_ = to_q31(sinf(theta));
+    cos_m1_ = to_q31(-2.0f * half * half); // cos T - 1 without cancellation
+  }
+
+  // Correction with an exact radius vector
+  void set(const float a, const float b) {
+    a_ = to_q16(a);
+    b_ = to_q16(b);
+  }
+
+  void next() {
+    const int32_t a = a_, b = b_;
+    a_ += mul_q31(a, cos_m1_) - mul_q31(b, sin_);
+    b_ += mul_q31(a, sin_) + mul_q31(b, cos_m1_);
+  }
+
+  float a() const { return a_ * (1.0f / 65536.0f); }
+  float b() const { return b_ * (1.0f / 65536.0f); }
+
+private:
+  static int32_t to_q16(const float v) { return int32_t(lroundf(v * 65536.0f)); }
+  static int32_t to_q31(const float v) { return int32_t(lroundf(v * 2147483648.0f)); }
+  static int32_t mul_q31(const int32_t v, const int32_t q) {
+    return int32_t((int64_t(v) * q + (int64_t(1) << 30)) >> 31);
+  }
+
+  int32_t a_ = 0, b_ = 0, sin_ = 0, cos_m1_ = 0;
+};
+
+/**
+ * Length of the arc segments: the longest chord within the tolerance (the deviation of a chord
+ * of length L is about L² / 8r), but not shorter than what can be traced during the minimum
+ * segment time at the feedrate. Shorter segments would be slowed down by the planner (SLOWDOWN)
+ * and would starve it: arcs would print slower than the equivalent G1 moves.
+ */
+inline float int_arc_segment_mm(const float radius, const float feedrate_mm_s, const float tolerance_mm,
+                                const uint32_t min_segment_time_us, const float min_mm, const float max_mm) {
+  float mm = sqrtf(8.0f * tolerance_mm * radius);
+  const float sustainable_mm = feedrate_mm_s * min_segment_time_us * 0.000001f;
+  if (sustainable_mm > mm) mm = sustainable_mm;
+  return mm < min_mm ? min_mm : mm > max_mm ? max_mm : mm;
+}
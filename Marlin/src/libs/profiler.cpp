@@ -0,0 +1,76 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * libs/profiler.cpp - Time spent in named zones of the main loop - @advi3++
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(HOT_PATH_PROFILER)
+
+#include "profiler.h"
+
+profiler_zone_t Profiler::zones[PZ_COUNT];
+
+/**
+ * Record a call of a zone
+ */
+void Profiler::record(const ProfilerZone zone, const uint32_t us) {
+  profiler_zone_t &z = zones[zone];
+
+  // Before the total overflows (after about 71 minutes in the zone), halve it and keep the average
+  if (z.total > 0xFFFFFFFFUL - us) { z.total >>= 1; z.calls >>= 1; }
+  z.total += us;
+  ++z.calls;
+
+  const uint16_t d = _MIN(us, 0xFFFFUL);
+  if (z.calls == 1 || d < z.min) z.min = d;
+  if (d > z.max) z.max = d;
+}
+
+/**
+ * Report the zones (M577)
+ */
+void Profiler::report() {
+  static PGMSTR(str_loop, "Loop");
+  static PGMSTR(str_idle, "Idle");
+  static PGMSTR(str_temperature, "Temperature");
+  static PGMSTR(str_queue, "Queue");
+  static PGMSTR(str_planner, "Planner");
+  static PGMSTR(str_lcd, "LCD");
+  static PGMSTR(str_dgus, "DGUS");
+
+  static PGM_P const zone_names[] PROGMEM = {
+    str_loop, str_idle, str_temperature, str_queue, str_planner, str_lcd, str_dgus
+  };
+  static_assert(COUNT(zone_names) == PZ_COUNT, "A name is missing for a profiler zone.");
+
+  for (uint8_t i = 0; i < PZ_COUNT; ++i) {
+    const profiler_zone_t &z = zones[i];
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&zone_names[i]));
+    SERIAL_ECHOLNPGM(": Calls: ", z.calls, " Min: ", z.min, " Avg: ", z.avg(), " Max: ", z.max, " (us)");
+  }
+}
+
+#endif // HOT_PATH_PROFILER
@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * libs/profiler.h - Time spent in named zones of the main loop
+ *
+ * HOT_PATH_PROFILER - @advi3++
+ *
+ * PROFILE_ZONE(NAME) at the start of a block measures the block with micros(), i.e. with
+ * Timer0 (4 µs or 64 cycles of resolution at 16 MHz). For each zone, the number of calls and
+ * the min, average and max durations are kept in a fixed table, reported by M577.
+ * Zones are inclusive: IDLE includes TEMPERATURE and LCD, LOOP includes everything.
+ * Without HOT_PATH_PROFILER, PROFILE_ZONE is nothing.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(HOT_PATH_PROFILER)
+
+enum ProfilerZone : uint8_t {
+  PZ_LOOP,          // An iteration of loop()
+  PZ_IDLE,          // idle()
+  PZ_TEMPERATURE,   // Temperature::task()
+  PZ_QUEUE,         // GCodeQueue::advance(), including the execution of the command
+  PZ_PLANNER,       // Planner::_populate_block()
+  PZ_LCD,           // The LCD panel (ADVi3pp Core::idle)
+  PZ_DGUS,          // Frames received from and sent to the DGUS panel
+  PZ_COUNT
+};
+
+struct profiler_zone_t {
+  uint32_t calls,   // Number of calls
+           total;   // Total duration (µs)
+  uint16_t min,     // Durations (µs), saturated
+           max;
+
+  uint16_t avg() const { return calls ? uint16_t(_MIN(total / calls, 0xFFFFUL)) : 0; }
+};
+
+class Profiler {
+public:
+  static profiler_zone_t zones[PZ_COUNT];
+
+  static void reset() { memset(zones, 0, sizeof(zones)); }
+  static void record(const ProfilerZone zone, const uint32_t us);
+  static void report();
+};
+
+class ProfileScope {
+public:
+  explicit ProfileScope(const ProfilerZone zone): zone_(zone), start_(micros()) {}
+  ~ProfileScope() { Profiler::record(zone_, micros() - start_); }
+
+private:
+  const ProfilerZone zone_;
+  const uint32_t start_;
+};
+
+#define PROFILE_ZONE(Z) const ProfileScope _profile_scope(PZ_##Z)
+
+#else
+
+#define PROFILE_ZONE(Z) NOOP
+
+#endif
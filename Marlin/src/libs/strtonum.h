@@ -0,0 +1,100 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * FAST_NUMBER_PARSER - @advi3++
+ *
+ * Conversion of G-code numbers ([-+]?[0-9]*.?[0-9]*, no exponent, no hexadecimal)
+ * without strtof / strtol, which are large and slow on AVR.
+ *
+ * Up to 9 significant digits are accumulated in a 32-bit integer and then scaled by
+ * an exact power of ten. When the digits fit in 24 bits (up to 7 digits, like 12345.67)
+ * and there are at most 10 decimals, the division is the only rounding and the result
+ * is identical to strtof. Otherwise, it is within 1 ulp.
+ */
+
+#include <stdint.h>
+
+namespace strtonum {
+
+  // Powers of ten exactly representable as floats
+  constexpr uint8_t MAX_EXACT_POWER = 10;
+  const float powers_of_ten[MAX_EXACT_POWER + 1] PROGMEM = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+  inline bool is_digit(const char c) { return uint8_t(c - '0') <= 9; }
+
+  inline float scale(float f, int8_t exponent) {
+    for (; exponent < -MAX_EXACT_POWER; exponent += MAX_EXACT_POWER) f /= pgm_read_float(&powers_of_ten[MAX_EXACT_POWER]);
+    for (; exponent > MAX_EXACT_POWER; exponent -= MAX_EXACT_POWER) f *= pgm_read_float(&powers_of_ten[MAX_EXACT_POWER]);
+    return exponent < 0 ? f / pgm_read_float(&powers_of_ten[-exponent]) : f * pgm_read_float(&powers_of_ten[exponent]);
+  }
+
+}
+
+// Equivalent of strtof(p, nullptr) for G-code numbers. Parsing stops at the first other character.
+inline float fast_strtof(const char *p) {
+  using namespace strtonum;
+  while (*p == ' ') ++p;
+  const bool negative = (*p == '-');
+  if (negative || *p == '+') ++p;
+
+  uint32_t mantissa = 0;
+  uint8_t digits = 0;   // Significant digits in mantissa
+  int8_t exponent = 0;
+
+  // Integer part. Digits beyond the precision only change the exponent.
+  for (; is_digit(*p); ++p) {
+    if (digits < 9) { mantissa = mantissa * 10 + (*p - '0'); if (mantissa) ++digits; }
+    else if (exponent < 127) ++exponent;
+  }
+
+  // Decimals. Zeros are kept pending so trailing ones do not use precision.
+  if (*p == '.') {
+    uint8_t zeros = 0;
+    for (++p; is_digit(*p) && digits < 9; ++p) {
+      if (*p == '0') { ++zeros; continue; }
+      for (; zeros && digits < 9 && exponent > -100; --zeros) { mantissa *= 10; if (mantissa) ++digits; --exponent; }
+      if (digits >= 9) break;
+      mantissa = mantissa * 10 + (*p - '0');
+      ++digits;
+      --exponent;
+    }
+  }
+
+  const float f = scale(mantissa, exponent);
+  return negative ? -f : f;
+}
+
+// Equivalent of strtol(p, nullptr, 10), without the saturation on overflow
+inline int32_t fast_strtol(const char *p) {
+  using namespace strtonum;
+  while (*p == ' ') ++p;
+  const bool negative = (*p == '-');
+  if (negative || *p == '+') ++p;
+  uint32_t value = 0;
+  for (; is_digit(*p); ++p) value = value * 10 + (*p - '0');
+  return negative ? -int32_t(value) : int32_t(value);
+}
+
+// Equivalent of strtoul(p, nullptr, 10), without the saturation on overflow
+inline uint32_t fast_strtoul(const char *p) { return uint32_t(fast_strtol(p)); }
@@ -432,8 +432,10 @@ void Endstops::poll() {
 
   TERN_(PINS_DEBUGGING, run_monitor()); // Report changes in endstop status
 
-  #if DISABLED(ENDSTOP_INTERRUPTS_FEATURE)
+  #if DISABLED(ENDSTOP_INTERRUPTS_FEATURE) && ENDSTOP_NOISE_THRESHOLD
     update();
+  #elif DISABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    if (abort_enabled()) update(); // @advi3++: Without debouncing, update does nothing when the endstops are not enabled
   #elif ENDSTOP_NOISE_THRESHOLD
     if (endstop_poll_count) update();
   #endif
@@ -0,0 +1,107 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * JD_CACHE - @advi3++
+ *
+ * Cache of the junction deviation factors, keyed by the quantized junction angle.
+ *
+ * The maximum junction speed is a * jd * s / (1 - s) with s = sin(theta / 2) = sqrt((1 - cos theta) / 2).
+ * The factor s / (1 - s) (and the angle used by JD_HANDLE_SMALL_SEGMENTS) only depends on cos theta,
+ * so the acceleration and the junction deviation are applied after the lookup and are always exact.
+ *
+ * The key is the float representation of 1 + cos theta (or 1 - cos theta for acute angles)
+ * truncated to JD_CACHE_MANTISSA_BITS: the resolution is relative (1/64), so it is fine for nearly
+ * straight junctions where the speed goes up as 1 / (1 + cos theta) and for nearly reversing ones
+ * where it goes down to 0. The factors are computed at the edge of the key with the most acute angle,
+ * so a cached value is never faster than the exact one. Since the result only depends on the key,
+ * it does not depend on the content of the cache.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#define JD_CACHE_MANTISSA_BITS 6
+
+template<uint8_t SIZE, bool SMALL_SEGMENTS>
+class JunctionDeviationCache {
+  static_assert(SIZE && !(SIZE & (SIZE - 1)), "The size of the cache has to be a power of 2.");
+
+public:
+  struct Factors {
+    float speed;  // s / (1 - s)
+    float theta;  // Junction angle for small segments (JD_HANDLE_SMALL_SEGMENTS)
+  };
+
+  // Factors for cos theta in [-1, 1[
+  const Factors &get(const float cos_theta) {
+    const uint16_t key = key_of(cos_theta);
+    Entry &entry = entries[(uint16_t(key * 0x9E37U) >> 8) & (SIZE - 1)]; // Fibonacci hashing
+    if (entry.key == key)
+      ++hits;
+    else {
+      ++misses;
+      entry.key = key;
+      compute(cos_of(key), entry.factors);
+    }
+    return entry.factors;
+  }
+
+  void reset_stats() { hits = misses = 0; }
+
+  // Key of cos theta, rounded up. It is based on 1 + cos theta for obtuse angles and on 1 - cos theta
+  // (bit 15 set) for acute angles, so the resolution is relative at both ends.
+  static uint16_t key_of(const float cos_theta) {
+    const bool acute = cos_theta >= 0;
+    const float u = acute ? 1.0f - cos_theta : 1.0f + cos_theta;
+    uint32_t bits;
+    memcpy(&bits, &u, sizeof(bits));
+    const uint16_t key = uint16_t(bits >> (23 - JD_CACHE_MANTISSA_BITS));
+    return acute ? key | 0x8000 : key + 1;
+  }
+
+  // Edge of a key, as a cos theta
+  static float cos_of(const uint16_t key) {
+    const uint32_t bits = uint32_t(key & 0x7FFF) << (23 - JD_CACHE_MANTISSA_BITS);
+    float u;
+    memcpy(&u, &bits, sizeof(u));
+    return (key & 0x8000) ? 1.0f - u : u - 1.0f;
+  }
+
+  static void compute(const float cos_theta, Factors &factors) {
+    const float sin_theta_d2 = sqrtf(0.5f * (1.0f - cos_theta));
+    factors.speed = sin_theta_d2 / (1.0f - sin_theta_d2);
+    if (SMALL_SEGMENTS) factors.theta = acosf(-cos_theta);
+  }
+
+  uint32_t hits = 0, misses = 0;
+
+private:
+  struct Entry {
+    uint16_t key;   // 0 is never a valid key
+    Factors factors;
+  };
+
+  Entry entries[SIZE] = {};
+};
@@ -66,6 +66,10 @@
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(EXTENSIBLE_UI) // @advi3++
+  #include "../lcd/extui/ui_api.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../core/debug_out.h"
 
@@ -1158,7 +1162,7 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
 #else // !IS_KINEMATIC
 
-  #if ENABLED(SEGMENT_LEVELED_MOVES) && DISABLED(AUTO_BED_LEVELING_UBL)
+  #if ENABLED(SEGMENT_LEVELED_MOVES) && NONE(AUTO_BED_LEVELING_UBL, ADAPTIVE_LEVELED_SEGMENTS) // @advi3++
 
     /**
      * Prepare a segmented move on a CARTESIAN setup.
@@ -1218,7 +1222,7 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       planner.buffer_line(destination, fr_mm_s, active_extruder, hints);
     }
 
-  #endif // SEGMENT_LEVELED_MOVES && !AUTO_BED_LEVELING_UBL
+  #endif // SEGMENT_LEVELED_MOVES && !AUTO_BED_LEVELING_UBL && !ADAPTIVE_LEVELED_SEGMENTS
 
   /**
    * Prepare a linear move in a Cartesian setup.
@@ -1239,7 +1243,7 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
             bedlevel.line_to_destination_cartesian(scaled_fr_mm_s, active_extruder); // UBL's motion routine needs to know about
             return true;                                                             // all moves, including Z-only moves.
           #endif
-        #elif ENABLED(SEGMENT_LEVELED_MOVES)
+        #elif ENABLED(SEGMENT_LEVELED_MOVES) && DISABLED(ADAPTIVE_LEVELED_SEGMENTS) // @advi3++
           segmented_line_to_destination(scaled_fr_mm_s);
           return false; // caller will update current_position
         #else
@@ -1950,6 +1954,16 @@ void prepare_line_to_destination() {
    * before updating the current position.
    */
 
+  #if ENABLED(EXTENSIBLE_UI) // @advi3++
+    // Report the homing of an axis to the UI, including when homeaxis() returns early on a failure
+    struct HomingAxisReport {
+      const AxisEnum axis;
+      bool success = false;
+      HomingAxisReport(const AxisEnum a) : axis(a) { ExtUI::onHomingAxisStart(ExtUI::axis_t(a)); }
+      ~HomingAxisReport() { ExtUI::onHomingAxisDone(ExtUI::axis_t(axis), success); }
+    };
+  #endif
+
   void homeaxis(const AxisEnum axis) {
 
     /* @advi3++: fix for extruder stepper noise on the X_MIN switch.
@@ -1974,6 +1988,8 @@ void prepare_line_to_destination() {
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM(">>> homeaxis(", C(AXIS_CHAR(axis)), ")");
 
+    TERN_(EXTENSIBLE_UI, HomingAxisReport report(axis)); // @advi3++
+
     const int axis_home_dir = TERN0(DUAL_X_CARRIAGE, axis == X_AXIS)
                 ? TOOL_X_HOME_DIR(active_extruder) : home_dir(axis);
 
@@ -2276,6 +2292,8 @@ void prepare_line_to_destination() {
       if (axis == Z_AXIS) fwretract.current_hop = 0.0;
     #endif
 
+    TERN_(EXTENSIBLE_UI, report.success = true); // @advi3++
+
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("<<< homeaxis(", C(AXIS_CHAR(axis)), ")");
 
   } // homeaxis()
@@ -0,0 +1,129 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * PID_FIXED_POINT - @advi3++
+ *
+ * PID_t computed with integers. The gains are kept as floats for the settings, M301, M304
+ * and the LCD, and are converted when they are set. Temperatures are in 1/16 °C, as given
+ * by THERMISTOR_LUT (HeaterInfo::celsius_16), and the terms in 1/256 of the power:
+ *
+ *   P = Kp * e                   Kp in Q8
+ *   I = Ki * sum(e)              Ki * PID_dT in Q16, sum(e) limited as with floats
+ *   D += K2 * (Kd * de - D)      Kd / PID_dT in Q4, K2 in Q12, Kd * de limited to 2^30
+ *
+ * Each term fits in 32 bits, so a cycle is a few 32-bit multiplications and shifts
+ * instead of a dozen float operations and a float division.
+ */
+template<int MIN_POW, int MAX_POW>
+struct PIDFixed_t {
+  protected:
+    static constexpr uint8_t TEMP_BITS = 4, TERM_BITS = 8, P_BITS = 8, I_BITS = 16, D_BITS = 4, K2_BITS = 12;
+    static constexpr int16_t RANGE = int16_t(PID_FUNCTIONAL_RANGE) << TEMP_BITS;
+    static constexpr int32_t K2 = int32_t((1.0f - float(PID_K1)) * (1UL << K2_BITS) + 0.5f);
+
+    bool pid_reset = true;
+    int16_t temp_dState = 0;                    // 1/16 °C
+    int32_t temp_iState = 0;                    // 1/16 °C
+    int32_t work_p = 0, work_i = 0, work_d = 0; // 1/256 of the power
+    int32_t kp = 0, ki = 0, kd = 0, i_max = 0;
+    int16_t de_max = 0;
+
+    static int32_t to_fixed(const float value, const uint8_t bits, const int32_t limit) {
+      const float v = value * float(1UL << bits);
+      return v <= 0 ? 0 : v >= float(limit) ? limit : int32_t(v + 0.5f);
+    }
+
+    static float to_power(const int32_t term) { return term * (1.0f / (1UL << TERM_BITS)); }
+
+    // K2 * value without overflow
+    static int32_t k2(const int32_t value) {
+      return (value >> K2_BITS) * K2 + (((value & (_BV(K2_BITS) - 1)) * K2) >> K2_BITS);
+    }
+
+    void update() {
+      kp = to_fixed(Kp, P_BITS, INT32_MAX / RANGE);
+      ki = to_fixed(Ki, I_BITS, INT32_MAX);
+      i_max = ki ? to_fixed(float(MAX_POW) / Ki - float(MIN_POW), TEMP_BITS, (INT32_MAX - RANGE) / ki) : 0;
+      kd = to_fixed(Kd, D_BITS, INT32_MAX);
+      de_max = kd ? int16_t(_MIN(int32_t(INT16_MAX), (INT32_MAX >> 1) / kd)) : 0;
+    }
+
+  public:
+    float Kp = 0, Ki = 0, Kd = 0;
+    float p() const { return Kp; }
+    float i() const { return unscalePID_i(Ki); }
+    float d() const { return unscalePID_d(Kd); }
+    float c() const { return 1; }
+    float f() const { return 0; }
+    float pTerm() const { return to_power(work_p); }
+    float iTerm() const { return to_power(work_i); }
+    float dTerm() const { return to_power(work_d); }
+    float cTerm() const { return 0; }
+    float fTerm() const { return 0; }
+    void set_Kp(float p) { Kp = p; update(); }
+    void set_Ki(float i) { Ki = scalePID_i(i); update(); }
+    void set_Kd(float d) { Kd = scalePID_d(d); update(); }
+    void set_Kc(float) {}
+    void set_Kf(float) {}
+    int low() const { return MIN_POW; }
+    int high() const { return MAX_POW; }
+    void reset() { pid_reset = true; update(); } // Also after a direct change of Kp, Ki or Kd (updatePID)
+    void set(float p, float i, float d, float c=1, float f=0) { set_Kp(p); set_Ki(i); set_Kd(d); set_Kc(c); set_Kf(f); }
+    void set(const raw_pid_t &raw) { set(raw.p, raw.i, raw.d); }
+    void set(const raw_pidcf_t &raw) { set(raw.p, raw.i, raw.d, raw.c, raw.f); }
+
+    float get_fan_scale_output(const uint8_t) { return 0; }
+
+    float get_extrusion_scale_output(const bool, const int32_t, const float, const int16_t) { return 0; }
+
+    // The current temperature is in 1/16 °C
+    float get_pid_output(const celsius_t target, const int16_t temp) {
+      const int16_t pid_error = (target << TEMP_BITS) - temp;
+      if (!target || pid_error < -RANGE) {
+        pid_reset = true;
+        return 0;
+      }
+      else if (pid_error > RANGE) {
+        pid_reset = true;
+        return MAX_POW;
+      }
+
+      if (pid_reset) {
+        pid_reset = false;
+        temp_iState = 0;
+        work_d = 0;
+      }
+
+      temp_iState = constrain(temp_iState + pid_error, 0, i_max);
+
+      work_p = (kp * pid_error) >> (P_BITS + TEMP_BITS - TERM_BITS);
+      work_i = (ki * temp_iState) >> (I_BITS + TEMP_BITS - TERM_BITS);
+      const int32_t d = (kd * constrain(temp_dState - temp, -de_max, de_max)) >> (D_BITS + TEMP_BITS - TERM_BITS);
+      work_d += k2(d) - k2(work_d);
+
+      temp_dState = temp;
+
+      return to_power(constrain(work_p + work_i + work_d + (int32_t(MIN_POW) << TERM_BITS), 0, int32_t(MAX_POW) << TERM_BITS));
+    }
+};
@@ -73,6 +73,7 @@
 #include "../gcode/parser.h"
 
 #include "../MarlinCore.h"
+#include "../libs/profiler.h" // @advi3++
 
 #if HAS_LEVELING
   #include "../feature/bedlevel/bedlevel.h"
@@ -149,6 +150,9 @@ float Planner::mm_per_step[DISTINCT_AXES];      // (mm) Millimeters per step
   #if HAS_LINEAR_E_JERK
     float Planner::max_e_jerk[DISTINCT_E];      // Calculated from junction_deviation_mm
   #endif
+  #if ENABLED(JD_CACHE) // @advi3++
+    JunctionDeviationCache<JD_CACHE_SIZE, ENABLED(JD_HANDLE_SMALL_SEGMENTS)> Planner::jd_cache;
+  #endif
 #endif
 
 #if HAS_CLASSIC_JERK
@@ -1621,7 +1625,9 @@ void Planner::check_axes_activity() {
         raw.z += bedlevel.get_z_correction(raw);
       #endif
 
-      TERN_(MESH_BED_LEVELING, raw.z += bedlevel.get_z_offset());
+      #if EITHER(MESH_BED_LEVELING, BED_TEMP_Z_COMPENSATION) // @advi3++
+        raw.z += bedlevel.get_z_offset();
+      #endif
 
     #endif
   }
@@ -1640,7 +1646,11 @@ void Planner::check_axes_activity() {
     #elif HAS_MESH
 
       const float z_correction = bedlevel.get_z_correction(raw),
-                  z_full_fade = DIFF_TERN(MESH_BED_LEVELING, raw.z, bedlevel.get_z_offset()),
+                  #if EITHER(MESH_BED_LEVELING, BED_TEMP_Z_COMPENSATION) // @advi3++
+                    z_full_fade = raw.z - bedlevel.get_z_offset(),
+                  #else
+                    z_full_fade = raw.z,
+                  #endif
                   z_no_fade = z_full_fade - z_correction;
 
       #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
@@ -1884,6 +1894,8 @@ bool Planner::_populate_block(
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints
 ) {
+  PROFILE_ZONE(PLANNER); // @advi3++
+
   int32_t LOGICAL_AXIS_LIST(
     de = target.e - position.e,
     da = target.a - position.a,
@@ -2706,6 +2718,23 @@ bool Planner::_populate_block(
         if (TERN0(HINTS_CURVE_RADIUS, hints.curve_radius)) {
           TERN_(HINTS_CURVE_RADIUS, vmax_junction_sqr = junction_acceleration * hints.curve_radius);
         }
+        #if ENABLED(JD_CACHE) // @advi3++
+        else {
+          NOLESS(junction_cos_theta, -0.999999f); // Check for numerical round-off to avoid divide by zero.
+
+          // Factors computed for a key (quantized angle), never faster than the exact ones
+          const auto &factors = jd_cache.get(junction_cos_theta);
+          vmax_junction_sqr = junction_acceleration * junction_deviation_mm * factors.speed;
+
+          #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
+            // For small moves with >135° junction (octagon) find speed for approximate arc
+            if (block->millimeters < 1 && junction_cos_theta < -0.7071067812f) {
+              const float limit_sqr = (block->millimeters * junction_acceleration) / factors.theta;
+              NOMORE(vmax_junction_sqr, limit_sqr);
+            }
+          #endif
+        }
+        #else
         else {
           NOLESS(junction_cos_theta, -0.999999f); // Check for numerical round-off to avoid divide by zero.
 
@@ -2801,6 +2830,7 @@ bool Planner::_populate_block(
 
           #endif // JD_HANDLE_SMALL_SEGMENTS
         }
+        #endif // JD_CACHE
       }
 
       // Get the lowest speed
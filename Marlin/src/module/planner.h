@@ -56,6 +56,10 @@
   #include "../libs/vector_3.h" // for matrix_3x3
 #endif
 
+#if ENABLED(JD_CACHE)
+  #include "jd_cache.h" // @advi3++
+#endif
+
 #if ENABLED(FWRETRACT)
   #include "../feature/fwretract.h"
 #endif
@@ -449,6 +453,9 @@ class Planner {
       #if HAS_LINEAR_E_JERK
         static float max_e_jerk[DISTINCT_E];          // Calculated from junction_deviation_mm
       #endif
+      #if ENABLED(JD_CACHE) // @advi3++
+        static JunctionDeviationCache<JD_CACHE_SIZE, ENABLED(JD_HANDLE_SMALL_SEGMENTS)> jd_cache; // M205 C
+      #endif
     #endif
 
     #if HAS_CLASSIC_JERK
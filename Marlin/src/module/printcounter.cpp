@@ -45,6 +45,10 @@ Stopwatch print_job_timer;      // Global Print Job Timer instance
   #include "../module/planner.h"
 #endif
 
+#if ENABLED(JOB_STATISTICS)
+  #include "../feature/jobstats.h"
+#endif
+
 // Service intervals
 #if HAS_SERVICE_INTERVALS
   #if SERVICE_INTERVAL_1 > 0
@@ -278,6 +282,7 @@ bool PrintCounter::start() {
     if (!paused) {
       data.totalPrints++;
       lastDuration = 0;
+      TERN_(JOB_STATISTICS, job_stats.start()); // @advi3++
     }
     return true;
   }
@@ -296,6 +301,7 @@ bool PrintCounter::_stop(const bool completed) {
       if (duration() > data.longestPrint)
         data.longestPrint = duration();
     }
+    TERN_(JOB_STATISTICS, job_stats.stop(completed)); // @advi3++
   }
   saveStats();
   return did_stop;
@@ -290,6 +290,13 @@ typedef struct SettingsDataStruct {
     bool xatc_enabled; // @advi3++
   #endif
 
+  //
+  // BED_TEMP_Z_COMPENSATION @advi3++
+  //
+  #if ENABLED(BED_TEMP_Z_COMPENSATION)
+    BedTempZ::Data bed_temp_z;                          // M870 S I Z
+  #endif
+
   //
   // AUTO_BED_LEVELING_UBL
   //
@@ -1015,6 +1022,14 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(xatc.enabled); // @advi3++
     #endif
 
+    //
+    // Bed Temperature Z Compensation @advi3++
+    //
+    #if ENABLED(BED_TEMP_Z_COMPENSATION)
+      _FIELD_TEST(bed_temp_z);
+      EEPROM_WRITE(bedlevel.temp_z.data());
+    #endif
+
     //
     // Unified Bed Leveling
     //
@@ -2039,6 +2054,18 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(xatc.enabled); // @advi3++
       #endif
 
+      //
+      // Bed Temperature Z Compensation @advi3++
+      //
+      #if ENABLED(BED_TEMP_Z_COMPENSATION)
+      {
+        _FIELD_TEST(bed_temp_z);
+        BedTempZ::Data bed_temp_z;
+        EEPROM_READ(bed_temp_z);
+        if (!validating) bedlevel.temp_z.set(bed_temp_z);
+      }
+      #endif
+
       //
       // Unified Bed Leveling active state
       //
@@ -2933,7 +2960,7 @@ void MarlinSettings::postprocess() {
     return false;
   }
 
-  #if ENABLED(AUTO_BED_LEVELING_UBL)
+  #if EITHER(AUTO_BED_LEVELING_UBL, HAS_BILINEAR_MESH_SLOTS) // @advi3++
 
     inline void ubl_invalid_slot(const int s) {
       DEBUG_ECHOLNPGM("?Invalid slot.\n", s, " mesh slots available.");
@@ -2951,16 +2978,54 @@ void MarlinSettings::postprocess() {
       return (datasize() + EEPROM_OFFSET + 32) & 0xFFF8;
     }
 
-    #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, bedlevel.z_values))
+    #if HAS_BILINEAR_MESH_SLOTS
+      #define MESH_STORE_SIZE (sizeof(LevelingBilinear::mesh_slot_t) + sizeof(uint16_t)) // @advi3++ Mesh and CRC
+    #else
+      #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, bedlevel.z_values))
+    #endif
 
     uint16_t MarlinSettings::calc_num_meshes() {
-      return (meshes_end - meshes_start_index()) / MESH_STORE_SIZE;
+      #if HAS_BILINEAR_MESH_SLOTS
+        // @advi3++
+        const uint16_t start = meshes_start_index();
+        return start < meshes_end ? _MIN(uint16_t(BILINEAR_MESH_SLOTS), uint16_t((meshes_end - start) / MESH_STORE_SIZE)) : 0;
+      #else
+        return (meshes_end - meshes_start_index()) / MESH_STORE_SIZE;
+      #endif
     }
 
     int MarlinSettings::mesh_slot_offset(const int8_t slot) {
       return meshes_end - (slot + 1) * MESH_STORE_SIZE;
     }
 
+    #if HAS_BILINEAR_MESH_SLOTS
+
+      // @advi3++: Write a mesh followed by its CRC
+      static bool write_mesh_slot(const int8_t slot, const LevelingBilinear::mesh_slot_t &mesh) {
+        const int16_t a = settings.calc_num_meshes();
+        if (!WITHIN(slot, 0, a - 1)) {
+          SERIAL_ECHOLNPGM("?Invalid slot (0..", a - 1, ").");
+          return true;
+        }
+
+        int pos = settings.mesh_slot_offset(slot);
+        uint16_t crc = 0, crc_of_crc = 0;
+        persistentStore.access_start();
+        bool status = persistentStore.write_data(pos, (const uint8_t*)&mesh, sizeof(mesh), &crc);
+        if (!status) status = persistentStore.write_data(pos, (const uint8_t*)&crc, sizeof(crc), &crc_of_crc);
+        persistentStore.access_finish();
+        return status;
+      }
+
+      // @advi3++: Empty a slot
+      void MarlinSettings::delete_mesh(const int8_t slot) {
+        LevelingBilinear::mesh_slot_t mesh{};
+        mesh.bed_temp = -1;
+        if (write_mesh_slot(slot, mesh)) SERIAL_ECHOLNPGM("?Unable to delete mesh data.");
+      }
+
+    #endif
+
     void MarlinSettings::store_mesh(const int8_t slot) {
 
       #if ENABLED(AUTO_BED_LEVELING_UBL)
@@ -2991,6 +3056,14 @@ void MarlinSettings::postprocess() {
         if (status) SERIAL_ECHOLNPGM("?Unable to save mesh data.");
         else        DEBUG_ECHOLNPGM("Mesh saved in slot ", slot);
 
+      #elif HAS_BILINEAR_MESH_SLOTS
+
+        // @advi3++
+        LevelingBilinear::mesh_slot_t mesh;
+        bedlevel.get_slot(mesh);
+        if (write_mesh_slot(slot, mesh)) SERIAL_ECHOLNPGM("?Unable to save mesh data.");
+        else                             SERIAL_ECHOLNPGM("Mesh saved in slot ", slot);
+
       #else
 
         // Other mesh types
@@ -2998,7 +3071,7 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
-    void MarlinSettings::load_mesh(const int8_t slot, void * const into/*=nullptr*/) {
+    bool MarlinSettings::load_mesh(const int8_t slot, void * const into/*=nullptr*/) {
 
       #if ENABLED(AUTO_BED_LEVELING_UBL)
 
@@ -3006,7 +3079,7 @@ void MarlinSettings::postprocess() {
 
         if (!WITHIN(slot, 0, a - 1)) {
           ubl_invalid_slot(a);
-          return;
+          return false;
         }
 
         int pos = mesh_slot_offset(slot);
@@ -3046,18 +3119,40 @@ void MarlinSettings::postprocess() {
         else        DEBUG_ECHOLNPGM("Mesh loaded from slot ", slot);
 
         EEPROM_FINISH();
+        return !status;
+
+      #elif HAS_BILINEAR_MESH_SLOTS
+
+        // @advi3++: Read the mesh (into a mesh_slot_t if given) and check its CRC
+        const int16_t a = calc_num_meshes();
+        if (!WITHIN(slot, 0, a - 1)) return false;
+
+        LevelingBilinear::mesh_slot_t mesh, * const dest = into ? (LevelingBilinear::mesh_slot_t*)into : &mesh;
+        int pos = mesh_slot_offset(slot);
+        uint16_t crc = 0, stored_crc = 0, crc_of_crc = 0;
+        persistentStore.access_start();
+        persistentStore.read_data(pos, (uint8_t*)dest, sizeof(mesh), &crc);
+        persistentStore.read_data(pos, (uint8_t*)&stored_crc, sizeof(stored_crc), &crc_of_crc);
+        persistentStore.access_finish();
+
+        if (crc != stored_crc || dest->bed_temp < 0) return false;
+        if (!into) {
+          bedlevel.set_slot(mesh);
+          SERIAL_ECHOLNPGM("Mesh loaded from slot ", slot, " (bed ", mesh.bed_temp, "C)");
+        }
+        return true;
 
       #else
 
         // Other mesh types
+        return false;
 
       #endif
     }
 
-    //void MarlinSettings::delete_mesh() { return; }
     //void MarlinSettings::defrag_meshes() { return; }
 
-  #endif // AUTO_BED_LEVELING_UBL
+  #endif // AUTO_BED_LEVELING_UBL || HAS_BILINEAR_MESH_SLOTS
 
 #else // !EEPROM_SETTINGS
 
@@ -3219,6 +3314,11 @@ void MarlinSettings::reset() {
   //
   TERN_(X_AXIS_TWIST_COMPENSATION, xatc.reset());
 
+  //
+  // Bed Temperature Z Compensation @advi3++
+  //
+  TERN_(BED_TEMP_Z_COMPENSATION, bedlevel.temp_z.reset());
+
   //
   // Nozzle-to-probe Offset
   //
@@ -3773,6 +3873,11 @@ void MarlinSettings::reset() {
     //
     TERN_(X_AXIS_TWIST_COMPENSATION, gcode.M423_report(forReplay));
 
+    //
+    // Bed Temperature Z Compensation @advi3++
+    //
+    TERN_(BED_TEMP_Z_COMPENSATION, gcode.M870_report(forReplay));
+
     //
     // Editable Servo Angles
     //
@@ -71,16 +71,20 @@ class MarlinSettings {
         if (!loaded && load()) loaded = true;
       }
 
-      #if ENABLED(AUTO_BED_LEVELING_UBL) // Eventually make these available if any leveling system
-                                         // That can store is enabled
+      #if EITHER(AUTO_BED_LEVELING_UBL, HAS_BILINEAR_MESH_SLOTS) // Eventually make these available if any leveling system
+                                                                 // That can store is enabled @advi3++
         static uint16_t meshes_start_index();
         FORCE_INLINE static uint16_t meshes_end_index() { return meshes_end; }
         static uint16_t calc_num_meshes();
         static int mesh_slot_offset(const int8_t slot);
         static void store_mesh(const int8_t slot);
-        static void load_mesh(const int8_t slot, void * const into=nullptr);
+        static bool load_mesh(const int8_t slot, void * const into=nullptr); // @advi3++ Return 'true' if the mesh was loaded ok
 
-        //static void delete_mesh();    // necessary if we have a MAT
+        #if HAS_BILINEAR_MESH_SLOTS
+          static void delete_mesh(const int8_t slot); // @advi3++
+        #else
+          //static void delete_mesh();    // necessary if we have a MAT
+        #endif
         //static void defrag_meshes();  // "
       #endif
 
@@ -107,8 +111,8 @@ class MarlinSettings {
 
       static bool validating;
 
-      #if ENABLED(AUTO_BED_LEVELING_UBL)  // Eventually make these available if any leveling system
-                                          // That can store is enabled
+      #if EITHER(AUTO_BED_LEVELING_UBL, HAS_BILINEAR_MESH_SLOTS) // Eventually make these available if any leveling system
+                                                                 // That can store is enabled @advi3++
         static const uint16_t meshes_end; // 128 is a placeholder for the size of the MAT; the MAT will always
                                           // live at the very end of the eeprom
       #endif
@@ -87,6 +87,10 @@ Stepper stepper; // Singleton
   #include "stepper/speed_lookuptable.h"
 #endif
 
+#if ENABLED(S_CURVE_TABLE)
+  #include "stepper/s_curve_lookuptable.h" // @advi3++
+#endif
+
 #include "endstops.h"
 #include "planner.h"
 #include "motion.h"
@@ -212,7 +216,13 @@ uint32_t Stepper::advance_divisor = 0,
   constexpr uint8_t Stepper::stepper_extruder;
 #endif
 
-#if ENABLED(S_CURVE_ACCELERATION)
+#if ENABLED(S_CURVE_TABLE) // @advi3++
+  uint32_t Stepper::bezier_F,       // Initial speed of the S-curve
+           Stepper::bezier_AV,      // Inverse of the duration of the S-curve
+           Stepper::bezier_D;       // Absolute speed change of the S-curve
+  bool Stepper::D_negative;         // If the speed is decreasing
+  bool Stepper::bezier_2nd_half;    // =false If Bézier curve has been initialized or not
+#elif ENABLED(S_CURVE_ACCELERATION)
   int32_t __attribute__((used)) Stepper::bezier_A __asm__("bezier_A");    // A coefficient in Bézier speed curve with alias for assembler
   int32_t __attribute__((used)) Stepper::bezier_B __asm__("bezier_B");    // B coefficient in Bézier speed curve with alias for assembler
   int32_t __attribute__((used)) Stepper::bezier_C __asm__("bezier_C");    // C coefficient in Bézier speed curve with alias for assembler
@@ -236,20 +246,20 @@ uint32_t Stepper::advance_divisor = 0,
   shaping_time_t      ShapingQueue::now = 0;
   shaping_time_t      ShapingQueue::times[shaping_echoes];
   shaping_echo_axis_t ShapingQueue::echo_axes[shaping_echoes];
-  uint16_t            ShapingQueue::tail = 0;
+  shaping_index_t     ShapingQueue::tail = 0; // @advi3++
 
   #if ENABLED(INPUT_SHAPING_X)
     shaping_time_t  ShapingQueue::delay_x;
     shaping_time_t  ShapingQueue::peek_x_val = shaping_time_t(-1);
-    uint16_t        ShapingQueue::head_x = 0;
-    uint16_t        ShapingQueue::_free_count_x = shaping_echoes - 1;
+    shaping_index_t ShapingQueue::head_x = 0; // @advi3++
+    shaping_index_t ShapingQueue::_free_count_x = shaping_echoes - 1; // @advi3++
     ShapeParams     Stepper::shaping_x;
   #endif
   #if ENABLED(INPUT_SHAPING_Y)
     shaping_time_t  ShapingQueue::delay_y;
     shaping_time_t  ShapingQueue::peek_y_val = shaping_time_t(-1);
-    uint16_t        ShapingQueue::head_y = 0;
-    uint16_t        ShapingQueue::_free_count_y = shaping_echoes - 1;
+    shaping_index_t ShapingQueue::head_y = 0; // @advi3++
+    shaping_index_t ShapingQueue::_free_count_y = shaping_echoes - 1; // @advi3++
     ShapeParams     Stepper::shaping_y;
   #endif
 #endif
@@ -868,9 +878,33 @@ void Stepper::apply_directions() {
    *      }
    *    These functions are translated to assembler for optimal performance.
    *    Coefficient calculation takes 70 cycles. Bezier point evaluation takes 150 cycles.
+   *
+   *  @advi3++ With S_CURVE_TABLE, the normalized curve s(t) = 10t^3 - 15t^4 + 6t^5 is read from
+   *  a PROGMEM table (see stepper/s_curve_lookuptable.h) and scaled by the speed change:
+   *
+   *      V(t) = VI + (VF - VI) * s(t)
+   *
+   *    This only needs one multiplication to get t, one 8x16 multiplication to interpolate
+   *    the table and one 16x16 multiplication to scale the result. Coefficient calculation
+   *    is a subtraction. Point evaluation is done without assembler, in s_curve_speed().
    */
 
-  #ifdef __AVR__
+  #if ENABLED(S_CURVE_TABLE)
+
+    void Stepper::_calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av) {
+      bezier_F = v0;
+      bezier_AV = av;
+      D_negative = v1 < v0;
+      bezier_D = D_negative ? v0 - v1 : v1 - v0;
+    }
+
+    FORCE_INLINE int32_t Stepper::_eval_bezier_curve(const uint32_t curr_step) {
+      // If dealing with the first step, save computing and return the initial speed
+      if (!curr_step) return bezier_F;
+      return s_curve_speed(bezier_F, bezier_D, D_negative, bezier_AV, curr_step);
+    }
+
+  #elif defined(__AVR__)
 
     // For AVR we use assembly to maximize speed
     void Stepper::_calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av) {
@@ -2588,7 +2622,13 @@ uint32_t Stepper::block_phase_isr() {
       // If the endstop is already pressed, endstop interrupts won't invoke
       // endstop_triggered and the move will grind. So check here for a
       // triggered endstop, which marks the block for discard on the next ISR.
-      endstops.update();
+      // @advi3++: Without debouncing, update does nothing when the endstops are not enabled
+      // (i.e. most of the time when printing) so avoid the call in the Stepper ISR.
+      #if ENDSTOP_NOISE_THRESHOLD
+        endstops.update();
+      #else
+        if (endstops.abort_enabled()) endstops.update();
+      #endif
 
       #if ENABLED(Z_LATE_ENABLE)
         // If delayed Z enable, enable it now. This option will severely interfere with
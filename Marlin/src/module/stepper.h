@@ -124,6 +124,7 @@
   #endif
 
   // S curve interpolation adds 160 cycles
+  // @advi3++: Also kept with S_CURVE_TABLE until its cost is measured on the ATmega2560
   #if ENABLED(S_CURVE_ACCELERATION)
     #define ISR_S_CURVE_CYCLES 160UL
   #else
@@ -372,6 +373,14 @@ constexpr ena_mask_t enable_overlap[] = {
                      shaping_echoes = max_step_rate / shaping_min_freq / 2 + 3;
 
   typedef IF<ENABLED(__AVR__), uint16_t, uint32_t>::type shaping_time_t;
+  // @advi3++ Use 8-bit indexes when the queue is small enough (faster in the ISR on AVR)
+  typedef IF<(shaping_echoes < 256), uint8_t, uint16_t>::type shaping_index_t;
+
+  #ifdef __AVR__
+    // @advi3++ The delay line is statically allocated: keep it bounded
+    static_assert(shaping_echoes * (sizeof(shaping_time_t) + 1) <= 1024,
+      "The input shaping queue needs more than 1KB of SRAM. Reduce SHAPING_MAX_STEPRATE or increase SHAPING_MIN_FREQ.");
+  #endif
   enum shaping_echo_t { ECHO_NONE = 0, ECHO_FWD = 1, ECHO_BWD = 2 };
   struct shaping_echo_axis_t {
     TERN_(INPUT_SHAPING_X, shaping_echo_t x:2);
@@ -383,19 +392,19 @@ constexpr ena_mask_t enable_overlap[] = {
       static shaping_time_t       now;
       static shaping_time_t       times[shaping_echoes];
       static shaping_echo_axis_t  echo_axes[shaping_echoes];
-      static uint16_t             tail;
+      static shaping_index_t      tail; // @advi3++
 
       #if ENABLED(INPUT_SHAPING_X)
         static shaping_time_t delay_x;    // = shaping_time_t(-1) to disable queueing
         static shaping_time_t peek_x_val;
-        static uint16_t head_x;
-        static uint16_t _free_count_x;
+        static shaping_index_t head_x; // @advi3++
+        static shaping_index_t _free_count_x; // @advi3++
       #endif
       #if ENABLED(INPUT_SHAPING_Y)
         static shaping_time_t delay_y;    // = shaping_time_t(-1) to disable queueing
         static shaping_time_t peek_y_val;
-        static uint16_t head_y;
-        static uint16_t _free_count_y;
+        static shaping_index_t head_y; // @advi3++
+        static shaping_index_t _free_count_y; // @advi3++
       #endif
 
     public:
@@ -432,7 +441,7 @@ constexpr ena_mask_t enable_overlap[] = {
           return forward;
         }
         static bool empty_x() { return head_x == tail; }
-        static uint16_t free_count_x() { return _free_count_x; }
+        static shaping_index_t free_count_x() { return _free_count_x; } // @advi3++
       #endif
       #if ENABLED(INPUT_SHAPING_Y)
         static shaping_time_t peek_y() { return peek_y_val; }
@@ -446,7 +455,7 @@ constexpr ena_mask_t enable_overlap[] = {
           return forward;
         }
         static bool empty_y() { return head_y == tail; }
-        static uint16_t free_count_y() { return _free_count_y; }
+        static shaping_index_t free_count_y() { return _free_count_y; } // @advi3++
       #endif
       static void purge() {
         const auto st = shaping_time_t(-1);
@@ -562,7 +571,13 @@ class Stepper {
       static constexpr uint8_t stepper_extruder = 0;
     #endif
 
-    #if ENABLED(S_CURVE_ACCELERATION)
+    #if ENABLED(S_CURVE_TABLE) // @advi3++
+      static uint32_t bezier_F,    // Initial speed of the S-curve
+                      bezier_AV,   // Inverse of the duration of the S-curve
+                      bezier_D;    // Absolute speed change of the S-curve
+      static bool D_negative;      // If the speed is decreasing
+      static bool bezier_2nd_half; // If Bézier curve has been initialized or not
+    #elif ENABLED(S_CURVE_ACCELERATION)
       static int32_t bezier_A,     // A coefficient in Bézier speed curve
                      bezier_B,     // B coefficient in Bézier speed curve
                      bezier_C;     // C coefficient in Bézier speed curve
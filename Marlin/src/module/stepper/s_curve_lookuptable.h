@@ -0,0 +1,96 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * S_CURVE_TABLE - @advi3++
+ *
+ * Normalized jerk-limited velocity profile s(t) = 10t^3 - 15t^4 + 6t^5 (0 <= t <= 1).
+ * This is the quintic Bézier of S_CURVE_ACCELERATION with P_0 = P_1 = P_2 = 0 and
+ * P_3 = P_4 = P_5 = 1, so the velocity at time t is simply:
+ *
+ *   V(t) = VI + (VF - VI) * s(t)
+ *
+ * s(t) is sampled at (1 << S_CURVE_TABLE_BITS) + 1 evenly spaced points in Q16 and
+ * linearly interpolated. With 64 intervals, the interpolation error is below 0.02%
+ * of (VF - VI), far below what the timer resolution can express.
+ *
+ * Generated by buildroot/share/scripts/createSCurveLookupTable.py
+ */
+
+#define S_CURVE_TABLE_BITS 6
+
+const uint16_t s_curve_lookuptable[65] PROGMEM = {
+      0,     2,    19,    63,   145,   277,   467,   723,
+   1052,  1460,  1951,  2529,  3196,  3955,  4806,  5749,
+   6784,  7909,  9121, 10418, 11797, 13253, 14781, 16378,
+  18036, 19751, 21515, 23323, 25168, 27042, 28938, 30849,
+  32768, 34687, 36598, 38494, 40368, 42213, 44021, 45785,
+  47500, 49158, 50755, 52283, 53739, 55118, 56415, 57627,
+  58752, 59787, 60730, 61581, 62340, 63007, 63585, 64076,
+  64484, 64813, 65069, 65259, 65391, 65473, 65517, 65534,
+  65535,
+};
+
+/**
+ * Evaluate s(t) for t in Q16 (0 <= t <= 0xFFFF). The result is in Q16.
+ * The upper S_CURVE_TABLE_BITS bits of t select the interval, the next 8 bits
+ * are the interpolation factor. Consecutive entries never differ by more than
+ * 1920, so the interpolation fits in an 8x16 multiplication.
+ */
+FORCE_INLINE static uint16_t s_curve_interpolate(const uint16_t t) {
+  const uint8_t index = t >> (16 - (S_CURVE_TABLE_BITS)),
+                fraction = uint8_t(t >> (8 - (S_CURVE_TABLE_BITS)));
+  const uint16_t s0 = pgm_read_word(&s_curve_lookuptable[index]),
+                 s1 = pgm_read_word(&s_curve_lookuptable[index + 1]);
+  #ifdef __AVR__
+    return s0 + MultiU8X16toH16(fraction, s1 - s0);
+  #else
+    return s0 + uint16_t((uint32_t(fraction) * (s1 - s0) + 0x80) >> 8);
+  #endif
+}
+
+// AV, the inverse of the duration of the curve, is (1<<24)/TS on AVR, (1<<32)/TS on the other CPUs
+#ifdef __AVR__
+  #define S_CURVE_AV_BITS 24
+#else
+  #define S_CURVE_AV_BITS 32
+#endif
+
+/**
+ * Speed at step curr_step of a curve starting at F and changing by D (decreasing if D_negative).
+ */
+FORCE_INLINE static uint32_t s_curve_speed(const uint32_t F, const uint32_t D, const bool D_negative,
+                                           const uint32_t AV, const uint32_t curr_step) {
+  // t in Q16. AV is rounded, t may slightly exceed 1 at the very end.
+  uint32_t t = (AV * curr_step) >> (S_CURVE_AV_BITS - 16);
+  if (t > 0xFFFFUL) t = 0xFFFFUL;
+
+  const uint16_t s = s_curve_interpolate(uint16_t(t));
+
+  // Speed change = D * s >> 16. D fits in 16 bits for most moves.
+  const uint32_t dv = D <= 0xFFFF
+    ? (uint32_t(uint16_t(D)) * s) >> 16
+    : ((D >> 8) * s) >> 8;
+
+  return D_negative ? F - dv : F + dv;
+}
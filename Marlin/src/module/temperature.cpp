@@ -36,6 +36,7 @@
 #include "endstops.h"
 #include "planner.h"
 #include "printcounter.h"
+#include "../libs/profiler.h" // @advi3++
 
 #if ANY(HAS_COOLER, LASER_COOLANT_FLOW_METER)
   #include "../feature/cooler.h"
@@ -1403,7 +1404,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
 
       #else // !PID_OPENLOOP
 
-        float out = tempinfo.pid.get_pid_output(tempinfo.target, tempinfo.celsius);
+        float out = tempinfo.pid.get_pid_output(tempinfo.target, TERN(PID_FIXED_POINT, tempinfo.celsius_16, tempinfo.celsius)); // @advi3++
 
         #if ENABLED(PID_FAN_SCALING)
           out += tempinfo.pid.get_fan_scale_output(thermalManager.fan_speed[extr]);
@@ -1906,6 +1907,8 @@ void Temperature::task() {
   if (no_reentry) return;
   REMEMBER(mh, no_reentry, true);
 
+  PROFILE_ZONE(TEMPERATURE); // @advi3++
+
   #if ENABLED(EMERGENCY_PARSER)
     if (emergency_parser.killed_by_M112) kill(FPSTR(M112_KILL_STR), nullptr, true);
 
@@ -2018,6 +2021,23 @@ void Temperature::task() {
   }                                                                       \
 }while(0)
 
+// @advi3++ Thermistor tables evenly spaced by raw value, generated at compile time
+#if ENABLED(THERMISTOR_LUT)
+  #include "thermistor/thermistor_lut.h"
+  #if TEMP_SENSOR_0_IS_THERMISTOR && !TEMP_SENSOR_0_IS_CUSTOM
+    #define HAS_THERMISTOR_LUT_0 1
+    constexpr ThermistorLUT thermistor_lut_0 PROGMEM = ThermistorLUT::make(TEMPTABLE_0);
+  #endif
+  #if TEMP_SENSOR_BED_IS_THERMISTOR && !TEMP_SENSOR_BED_IS_CUSTOM
+    #define HAS_THERMISTOR_LUT_BED 1
+    #if HAS_THERMISTOR_LUT_0 && TEMP_SENSOR_BED == TEMP_SENSOR_0
+      #define thermistor_lut_bed thermistor_lut_0 // Same table
+    #else
+      constexpr ThermistorLUT thermistor_lut_bed PROGMEM = ThermistorLUT::make(TEMPTABLE_BED);
+    #endif
+  #endif
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -2258,6 +2278,9 @@ void Temperature::task() {
     }
 
     #if HAS_HOTEND_THERMISTOR
+      #if HAS_THERMISTOR_LUT_0
+        if (e == 0) return thermistor_lut_0.to_celsius(raw); // @advi3++
+      #endif
       // Thermistor with conversion table?
       const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
       SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
@@ -2281,6 +2304,8 @@ void Temperature::task() {
       #else
         return (int16_t)raw * 0.25f;
       #endif
+    #elif HAS_THERMISTOR_LUT_BED
+      return thermistor_lut_bed.to_celsius(raw); // @advi3++
     #elif TEMP_SENSOR_BED_IS_THERMISTOR
       SCAN_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN);
     #elif TEMP_SENSOR_BED_IS_AD595
@@ -2422,12 +2447,33 @@ void Temperature::updateTemperaturesFromRawValues() {
     temp_bed.setraw(read_max_tc_bed());
   #endif
 
-  #if HAS_HOTEND
-    HOTEND_LOOP() temp_hotend[e].celsius = analog_to_celsius_hotend(temp_hotend[e].getraw(), e);
-  #endif
+  #if ENABLED(PID_FIXED_POINT) // @advi3++ The heaters also in 1/16 °C, straight from THERMISTOR_LUT when there is a table
+    #if HAS_HOTEND
+      HOTEND_LOOP() {
+        #if HAS_THERMISTOR_LUT_0
+          if (e == 0) { temp_hotend[0].set_celsius_16(thermistor_lut_0.convert(temp_hotend[0].getraw())); continue; }
+        #endif
+        temp_hotend[e].set_celsius(analog_to_celsius_hotend(temp_hotend[e].getraw(), e));
+      }
+    #endif
+    #if HAS_HEATED_BED && HAS_THERMISTOR_LUT_BED
+      temp_bed.set_celsius_16(thermistor_lut_bed.convert(temp_bed.getraw()));
+    #elif HAS_HEATED_BED
+      temp_bed.set_celsius(analog_to_celsius_bed(temp_bed.getraw()));
+    #endif
+    #if HAS_HEATED_CHAMBER
+      temp_chamber.set_celsius(analog_to_celsius_chamber(temp_chamber.getraw()));
+    #elif HAS_TEMP_CHAMBER
+      temp_chamber.celsius = analog_to_celsius_chamber(temp_chamber.getraw());
+    #endif
+  #else
+    #if HAS_HOTEND
+      HOTEND_LOOP() temp_hotend[e].celsius = analog_to_celsius_hotend(temp_hotend[e].getraw(), e);
+    #endif
 
-  TERN_(HAS_HEATED_BED,     temp_bed.celsius       = analog_to_celsius_bed(temp_bed.getraw()));
-  TERN_(HAS_TEMP_CHAMBER,   temp_chamber.celsius   = analog_to_celsius_chamber(temp_chamber.getraw()));
+    TERN_(HAS_HEATED_BED,     temp_bed.celsius       = analog_to_celsius_bed(temp_bed.getraw()));
+    TERN_(HAS_TEMP_CHAMBER,   temp_chamber.celsius   = analog_to_celsius_chamber(temp_chamber.getraw()));
+  #endif
   TERN_(HAS_TEMP_COOLER,    temp_cooler.celsius    = analog_to_celsius_cooler(temp_cooler.getraw()));
   TERN_(HAS_TEMP_PROBE,     temp_probe.celsius     = analog_to_celsius_probe(temp_probe.getraw()));
   TERN_(HAS_TEMP_BOARD,     temp_board.celsius     = analog_to_celsius_board(temp_board.getraw()));
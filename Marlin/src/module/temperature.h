@@ -155,6 +155,12 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
   #define scalePID_d(d)   ( float(d) / PID_dT )
   #define unscalePID_d(d) ( float(d) * PID_dT )
 
+  // @advi3++ PID computed with integers
+  #if ENABLED(PID_FIXED_POINT)
+    #include "pid_fixed.h"
+    template<int MIN_POW, int MAX_POW> using PID_t = PIDFixed_t<MIN_POW, MAX_POW>;
+  #else
+
   /// @brief The default PID class, only has Kp, Ki, Kd, other classes extend this one
   /// @tparam MIN_POW output when current is above target by functional_range
   /// @tparam MAX_POW output when current is below target by functional_range
@@ -227,6 +233,8 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
 
   };
 
+  #endif // !PID_FIXED_POINT
+
 #endif // HAS_PID_HEATING
 
 #if ENABLED(PIDTEMP)
@@ -419,6 +427,11 @@ typedef struct HeaterInfo : public TempInfo {
   uint8_t soft_pwm_amount;
   bool is_below_target(const celsius_t offs=0) const { return (target - celsius > offs); } // celsius < target - offs
   bool is_above_target(const celsius_t offs=0) const { return (celsius - target > offs); } // celsius > target + offs
+  #if ENABLED(PID_FIXED_POINT) // @advi3++
+    int16_t celsius_16; // celsius in 1/16 °C, read by PIDFixed_t
+    void set_celsius(const celsius_float_t c) { celsius = c; celsius_16 = int16_t(c * 16 + 0.5f); }
+    void set_celsius_16(const int16_t c) { celsius_16 = c; celsius = c * (1.0f / 16); } // From THERMISTOR_LUT
+  #endif
 } heater_info_t;
 
 // A heater with PID stabilization
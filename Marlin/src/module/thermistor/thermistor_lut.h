@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * THERMISTOR_LUT - @advi3++
+ *
+ * The table of a thermistor resampled at compile time at raw ADC values evenly spaced
+ * by 1 << THERMISTOR_LUT_SHIFT, in 1/16 °C. A conversion is then an index (the upper
+ * bits of the raw value) and an integer interpolation with the lower bits, instead of
+ * a bisection and a float division (SCAN_THERMISTOR_TABLE).
+ *
+ * With OVERSAMPLENR 16 and THERMISTOR_LUT_SHIFT 6 (4 ADC counts), a table has 257
+ * entries (514 bytes of flash). For table 1, the difference with the interpolation of
+ * the original table is below 0.25 °C up to 260 °C and below 0.65 °C up to 275 °C.
+ */
+
+struct ThermistorLUT {
+  static constexpr uint8_t SHIFT = THERMISTOR_LUT_SHIFT;
+  static constexpr uint8_t FRACTION_BITS = 4;
+  static constexpr uint16_t SIZE = (uint16_t(MAX_RAW_THERMISTOR_VALUE) >> SHIFT) + 2;
+
+  static_assert(SIZE <= 1025, "THERMISTOR_LUT_SHIFT is too small for the ADC range.");
+
+  int16_t celsius[SIZE];
+
+  // Temperature in 1/16 °C (the object is in PROGMEM)
+  int16_t convert(const raw_adc_t raw) const {
+    const uint16_t index = raw >> SHIFT;
+    const int16_t c0 = int16_t(pgm_read_word(&celsius[index])),
+                  c1 = int16_t(pgm_read_word(&celsius[index + 1]));
+    return c0 + int16_t((int32_t(c1 - c0) * (raw & (_BV(SHIFT) - 1))) >> SHIFT);
+  }
+
+  celsius_float_t to_celsius(const raw_adc_t raw) const {
+    return convert(raw) * (1.0f / _BV(FRACTION_BITS));
+  }
+
+  // Build the table from a thermistor table sorted by raw value
+  template<size_t LEN>
+  static constexpr ThermistorLUT make(const temp_entry_t (&table)[LEN]) {
+    ThermistorLUT lut{};
+    for (uint16_t i = 0; i < SIZE; ++i) lut.celsius[i] = interpolate(table, uint32_t(i) << SHIFT);
+    return lut;
+  }
+
+private:
+  // SCAN_THERMISTOR_TABLE in 1/16 °C, rounded
+  template<size_t LEN>
+  static constexpr int16_t interpolate(const temp_entry_t (&table)[LEN], const uint32_t raw) {
+    if (raw <= table[0].value) return table[0].celsius * _BV(FRACTION_BITS);
+    for (size_t i = 1; i < LEN; ++i) {
+      if (raw > table[i].value) continue;
+      const int32_t dv = table[i].value - table[i - 1].value,
+                    n = int32_t(raw - table[i - 1].value) * (table[i].celsius - table[i - 1].celsius) * _BV(FRACTION_BITS);
+      return table[i - 1].celsius * _BV(FRACTION_BITS) + (n >= 0 ? (n + dv / 2) / dv : -((dv / 2 - n) / dv));
+    }
+    return table[LEN - 1].celsius * _BV(FRACTION_BITS);
+  }
+};
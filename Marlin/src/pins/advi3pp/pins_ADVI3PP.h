@@ -46,13 +46,13 @@
   #endif
 #elif MB(ADVI3PP_I3_PLUS_52C)
   #define Z_STOP_PIN             6   // PH3 / PWM6
-  #define Z_MIN_PROBE_PIN        6   // PH3 / PCINT8
+  #define Z_MIN_PROBE_PIN        6   // PH3 / PWM6
   #if ENABLED(BLTOUCH)
     #define SERVO0_PIN          40   // PG1 / !RD
   #endif
 #elif MB(ADVI3PP_I3_PLUS_54)
-  #define Z_STOP_PIN             6   // PH3 / PCINT8
-  #define Z_MIN_PROBE_PIN        6   // PH3 / PCINT8
+  #define Z_STOP_PIN             6   // PH3 / PWM6
+  #define Z_MIN_PROBE_PIN        6   // PH3 / PWM6
   #if ENABLED(BLTOUCH)
     // Assummes you are using a sub board from MR.S.J.D Developments
     // https://oshwlab.com/MrGamecase/wanhao-duplicator-i3-mkii-subboard
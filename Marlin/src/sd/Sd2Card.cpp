@@ -121,6 +121,16 @@
 // Send command and return error code. Return zero for OK
 uint8_t DiskIODriver_SPI_SD::cardCommand(const uint8_t cmd, const uint32_t arg) {
 
+  // @advi3++ Terminate a multiple block read left open by SdStream
+  #if ENABLED(SD_STREAM)
+    if (readingMultiple && cmd != CMD12) readStop();
+  #endif
+
+  // @advi3++ Wait for the end of a block write and check its status before any other command
+  #if ENABLED(SD_WRITE_BEHIND)
+    if (writePending && !finishWrite()) return (status_ = 0xFF);
+  #endif
+
   #if ENABLED(SDCARD_COMMANDS_SPLIT)
     if (cmd != CMD12) chipDeselect();
   #endif
@@ -286,6 +296,7 @@ bool DiskIODriver_SPI_SD::init(const uint8_t sckRateID, const pin_t chipSelectPi
 
   errorCode_ = type_ = 0;
   chipSelectPin_ = chipSelectPin;
+  TERN_(SD_STREAM, readingMultiple = false); // @advi3++
 
   // 16-bit init start time allows over a minute
   #if SD_INIT_TIMEOUT
@@ -568,6 +579,7 @@ bool DiskIODriver_SPI_SD::readStart(uint32_t blockNumber) {
 
   const bool success = !cardCommand(CMD18, blockNumber);
   if (!success) error(SD_CARD_ERROR_CMD18);
+  TERN_(SD_STREAM, readingMultiple = success); // @advi3++
   chipDeselect();
   return success;
 }
@@ -578,6 +590,7 @@ bool DiskIODriver_SPI_SD::readStart(uint32_t blockNumber) {
  * \return true for success, false for failure.
  */
 bool DiskIODriver_SPI_SD::readStop() {
+  TERN_(SD_STREAM, readingMultiple = false); // @advi3++
   chipSelect();
   const bool success = !cardCommand(CMD12, 0);
   if (!success) error(SD_CARD_ERROR_CMD12);
@@ -631,11 +644,22 @@ bool DiskIODriver_SPI_SD::writeBlock(uint32_t blockNumber, const uint8_t * const
   #endif
 
   if (type() != SD_CARD_TYPE_SDHC) blockNumber <<= 9; // Use address if not SDHC card
+  #if ENABLED(SD_WRITE_BEHIND)
+    if (writePending && !finishWrite()) { chipDeselect(); return false; } // @advi3++ Keep the error of the previous block
+  #endif
   bool success = !cardCommand(CMD24, blockNumber);
   if (!success) {
     error(SD_CARD_ERROR_CMD24);
   }
   else if (writeData(DATA_START_BLOCK, src)) {
+    #if ENABLED(SD_WRITE_BEHIND)
+      // @advi3++ Return while the card is flashing. The next command waits for its end and checks the status.
+      if (writeBehind_) {
+        writePending = true;
+        chipDeselect();
+        return true;
+      }
+    #endif
     #if SD_WRITE_TIMEOUT
       success = waitNotBusy(SD_WRITE_TIMEOUT);        // Wait for flashing to complete
       if (!success) error(SD_CARD_ERROR_WRITE_TIMEOUT);
@@ -652,6 +676,38 @@ bool DiskIODriver_SPI_SD::writeBlock(uint32_t blockNumber, const uint8_t * const
   return success;
 }
 
+#if ENABLED(SD_WRITE_BEHIND) // @advi3++
+
+  /**
+   * Wait for the end of the flashing of the last block written and check its status (CMD13)
+   * \return true for success, false for failure.
+   */
+  bool DiskIODriver_SPI_SD::finishWrite() {
+    writePending = false;
+    chipSelect();
+    bool success = waitNotBusy(SD_WRITE_TIMEOUT);
+    if (!success)
+      error(SD_CARD_ERROR_WRITE_TIMEOUT);
+    else {
+      success = !(cardCommand(CMD13, 0) || spiRec());
+      if (!success) error(SD_CARD_ERROR_WRITE_PROGRAMMING);
+    }
+    chipDeselect();
+    return success;
+  }
+
+  /**
+   * Enable or disable the write behind of the blocks (binary file transfers)
+   * \param[in] enable Return from writeBlock before the end of the flashing.
+   * \return false if the last block written failed.
+   */
+  bool DiskIODriver_SPI_SD::writeBehind(const bool enable) {
+    writeBehind_ = enable;
+    return !writePending || finishWrite();
+  }
+
+#endif
+
 /**
  * Write one data block in a multiple block write sequence
  * \param[in] src Pointer to the location of the data to be written.
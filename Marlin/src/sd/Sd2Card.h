@@ -165,10 +165,27 @@ public:
 
   bool isReady() override { return ready; };
 
+  #if ENABLED(SD_STREAM) // @advi3++
+    // A multiple block read is in progress. Any other command terminates it first.
+    bool isReadingMultiple() const { return readingMultiple; }
+  #endif
+
   void idle() override {}
 
+  #if ENABLED(SD_WRITE_BEHIND) // @advi3++
+    bool writeBehind(const bool enable) override;
+  #endif
+
 private:
   bool ready = false;
+  #if ENABLED(SD_STREAM)
+    bool readingMultiple = false; // @advi3++
+  #endif
+  #if ENABLED(SD_WRITE_BEHIND) // @advi3++
+    bool writeBehind_ = false,  // Set during binary file transfers only
+         writePending = false;  // The card is flashing a block, its status is not yet checked
+    bool finishWrite();
+  #endif
   uint8_t chipSelectPin_,
           errorCode_,
           spiRate_,
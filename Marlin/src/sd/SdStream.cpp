@@ -0,0 +1,186 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * sd/SdStream.cpp - @advi3++
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_STREAM)
+
+#include "SdStream.h"
+
+SdBaseFile *SdStream::file_;
+SdVolume *SdStream::vol_;
+uint32_t SdStream::size_, SdStream::pos_;
+uint8_t SdStream::current_;
+uint32_t SdStream::sectors_[SD_STREAM_BUFFERS];
+uint8_t SdStream::data_[SD_STREAM_BUFFERS][512];
+SdStream::Run SdStream::runs_[SD_STREAM_RUNS];
+uint8_t SdStream::nbRuns_, SdStream::oldestRun_;
+uint32_t SdStream::nextBlock_;
+uint16_t SdStream::stalls_;
+
+static DiskIODriver_SPI_SD* driver(SdVolume * const vol) { return static_cast<DiskIODriver_SPI_SD*>(vol->sdCard()); }
+
+/**
+ * Start streaming a file opened for read, from its beginning.
+ */
+void SdStream::open(SdBaseFile &file) {
+  close();
+  file_ = &file;
+  vol_ = file.volume();
+  size_ = file.fileSize();
+  pos_ = 0;
+  current_ = 0;
+  for (uint8_t i = 0; i < SD_STREAM_BUFFERS; ++i) sectors_[i] = NO_SECTOR;
+  nbRuns_ = oldestRun_ = 0;
+}
+
+/**
+ * Stop streaming and terminate the multiple block read, if any.
+ */
+void SdStream::close() {
+  if (file_ && driver(vol_)->isReadingMultiple()) driver(vol_)->readStop();
+  file_ = nullptr;
+}
+
+/**
+ * Get the next byte of the file or -1 at the end of the file or on error.
+ */
+int16_t SdStream::get() {
+  if (!file_ || pos_ >= size_) return -1;
+
+  const uint32_t sector = pos_ >> 9;
+  if (sectors_[current_] != sector) {
+    // Next buffer, already read ahead by prefetch or to be read now
+    current_ = (current_ + 1) % SD_STREAM_BUFFERS;
+    if (sectors_[current_] != sector) {
+      ++stalls_;                                  // Not read ahead, wait for the card
+      if (!read(current_, sector)) return -1;
+    }
+  }
+
+  return data_[current_][pos_++ & 0x1FF];
+}
+
+/**
+ * Read the sector following the current one in the other buffer, if not already done.
+ */
+void SdStream::prefetch() {
+  #if SD_STREAM_BUFFERS > 1
+    if (!file_) return;
+    const uint32_t sector = (pos_ >> 9) + 1;
+    const uint8_t next = (current_ + 1) % SD_STREAM_BUFFERS;
+    if (sectors_[next] != sector && (sector << 9) < size_) read(next, sector);
+  #endif
+}
+
+/**
+ * Read a sector of the file in a buffer. Continue the multiple block read if the block
+ * follows the previous one, otherwise start a new one.
+ */
+bool SdStream::read(const uint8_t buffer, const uint32_t sector) {
+  sectors_[buffer] = NO_SECTOR;
+
+  uint32_t block;
+  if (!blockOf(sector, block)) return false;
+
+  DiskIODriver_SPI_SD * const card = driver(vol_);
+  const bool reading = card->isReadingMultiple();
+  if (!(reading && block == nextBlock_)) {
+    if (reading) card->readStop();
+    if (!card->readStart(block)) return false;
+  }
+
+  if (!card->readData(data_[buffer])) {
+    // Try again with a single block read (with SD_CHECK_AND_RETRY, it retries)
+    card->readStop();
+    if (!card->readBlock(block, data_[buffer])) return false;
+  }
+  else
+    nextBlock_ = block + 1;
+
+  sectors_[buffer] = sector;
+  return true;
+}
+
+/**
+ * Block of the volume holding a sector of the file.
+ */
+bool SdStream::blockOf(const uint32_t sector, uint32_t &block) {
+  uint32_t cluster;
+  if (!clusterOf(sector >> vol_->clusterSizeShift(), cluster)) return false;
+  block = vol_->clusterStartBlock(cluster) + (sector & (vol_->blocksPerCluster() - 1));
+  return true;
+}
+
+/**
+ * Cluster of the volume holding a cluster of the file. Runs of contiguous clusters are
+ * cached and extended while the file is read, so the FAT is only read when the file
+ * crosses a cluster boundary for the first time.
+ */
+bool SdStream::clusterOf(const uint32_t index, uint32_t &cluster) {
+  // Run holding index or closest run ending before it
+  Run *run = nullptr;
+  for (uint8_t i = 0; i < nbRuns_; ++i) {
+    Run &r = runs_[i];
+    if (index < r.index) continue;
+    if (index < r.index + r.count) { cluster = r.cluster + (index - r.index); return true; }
+    if (!run || r.index > run->index) run = &r;
+  }
+
+  // None: start from the first cluster of the file
+  if (!run) {
+    run = newRun();
+    *run = { 0, file_->firstCluster(), 1 };
+  }
+
+  // Follow the chain up to index, extending the run or starting a new one
+  uint32_t current = run->index + run->count - 1, last = run->cluster + run->count - 1;
+  while (current < index) {
+    uint32_t next;
+    if (!vol_->fatGet(last, &next) || vol_->isEOC(next)) return false;
+    ++current;
+    if (next == last + 1 && run->count < 0xFFFF)
+      ++run->count;
+    else {
+      run = newRun();
+      *run = { current, next, 1 };
+    }
+    last = next;
+  }
+
+  cluster = last;
+  return true;
+}
+
+// A free run or the oldest one
+SdStream::Run* SdStream::newRun() {
+  if (nbRuns_ < SD_STREAM_RUNS) return &runs_[nbRuns_++];
+  Run * const run = &runs_[oldestRun_];
+  oldestRun_ = (oldestRun_ + 1) % SD_STREAM_RUNS;
+  return run;
+}
+
+#endif // SD_STREAM
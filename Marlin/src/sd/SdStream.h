@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * sd/SdStream.h
+ *
+ * SD_STREAM - @advi3++
+ *
+ * Sequential reading of the file being printed, independent of the volume cache:
+ *
+ *  - SD_STREAM_BUFFERS sectors: one is consumed while the next one is read ahead
+ *    (prefetch is called when the command queue is full, so get() seldom waits).
+ *  - A cache of the cluster chain as runs of contiguous clusters. FAT lookups no more
+ *    evict the data and are only done when the file crosses a cluster boundary.
+ *  - Consecutive sectors are read with a single multiple block read (CMD18) kept open
+ *    until another command is sent to the card.
+ */
+
+#include "SdBaseFile.h"
+
+#include <stdint.h>
+
+class SdStream {
+public:
+  static void open(SdBaseFile &file);
+  static void close();
+  static bool isOpen() { return file_ != nullptr; }
+
+  static int16_t get();
+  static void seek(const uint32_t pos) { pos_ = _MIN(pos, size_); }
+  static uint32_t position() { return pos_; }
+
+  static void prefetch();
+
+  // Number of sectors get() had to wait for (not read ahead)
+  static uint16_t stalls() { return stalls_; }
+
+  // A sector buffer for other uses while no file is streamed (BINARY_FILE_TRANSFER), or nullptr
+  static uint8_t* lend() { return isOpen() ? nullptr : data_[0]; }
+
+private:
+  static constexpr uint32_t NO_SECTOR = 0xFFFFFFFF;
+
+  // Clusters [index, index + count) of the file are clusters [cluster, cluster + count) of the volume
+  struct Run { uint32_t index, cluster; uint16_t count; };
+
+  static bool read(const uint8_t buffer, const uint32_t sector);
+  static bool blockOf(const uint32_t sector, uint32_t &block);
+  static bool clusterOf(const uint32_t index, uint32_t &cluster);
+  static Run* newRun();
+
+  static SdBaseFile *file_;
+  static SdVolume *vol_;
+  static uint32_t size_, pos_;
+
+  static uint8_t current_;                        // Buffer being consumed
+  static uint32_t sectors_[SD_STREAM_BUFFERS];    // Sector of the file in each buffer
+  static uint8_t data_[SD_STREAM_BUFFERS][512];
+
+  static Run runs_[SD_STREAM_RUNS];
+  static uint8_t nbRuns_, oldestRun_;
+
+  static uint32_t nextBlock_;                     // Next block of the multiple block read
+  static uint16_t stalls_;
+};
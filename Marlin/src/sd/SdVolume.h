@@ -132,6 +132,7 @@ class SdVolume {
  private:
   // Allow SdBaseFile access to SdVolume private data.
   friend class SdBaseFile;
+  friend class SdStream; // @advi3++
 
   // value for dirty argument in cacheRawBlock to indicate read from cache
   static bool const CACHE_FOR_READ = false;
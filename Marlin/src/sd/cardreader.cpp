@@ -605,6 +605,7 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(ADVANCED_PAUSE_FEATURE, did_pause_print = 0);
   TERN_(DWIN_CREALITY_LCD, HMI_flag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
+  TERN_(SD_STREAM, SdStream::close()); // @advi3++
   if (isFileOpen()) file.close();
   TERN_(SD_RESORT, if (re_sort) presort());
 }
@@ -713,6 +714,8 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_STREAM, SdStream::open(file)); // @advi3++
+    TERN_(BINARY_GCODE, flag.sdpos_changed = flag.file_opened = true); // @advi3++
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -886,6 +889,7 @@ void CardReader::write_command(char * const buf) {
 #endif
 
 void CardReader::closefile(const bool store_location/*=false*/) {
+  TERN_(SD_STREAM, SdStream::close()); // @advi3++
   file.sync();
   file.close();
   flag.saving = flag.logging = false;
@@ -1425,6 +1429,7 @@ int16_t CardReader::get_num_items() {
 // Return from procedure or close out the Print Job
 //
 void CardReader::fileHasFinished() {
+  TERN_(SD_STREAM, SdStream::close()); // @advi3++
   file.close();
   #if HAS_MEDIA_SUBCALLS
     if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
@@ -1457,7 +1462,8 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    // @advi3++: No O_SYNC, PrintJobRecovery::write syncs once after its writes
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC))
       openFailed(recovery.filename);
     else if (!read)
       echo_write_to_file(recovery.filename);
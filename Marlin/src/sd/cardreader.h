@@ -59,6 +59,10 @@ extern const char M23_STR[], M24_STR[];
 #include "SdFile.h"
 #include "disk_io_driver.h"
 
+#if ENABLED(SD_STREAM)
+  #include "SdStream.h" // @advi3++
+#endif
+
 #if ENABLED(USB_FLASH_DRIVE_SUPPORT)
   #include "usb_flashdrive/Sd2Card_FlashDrive.h"
 #endif
@@ -96,6 +100,10 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(BINARY_GCODE)
+         , sdpos_changed:1      // The file was opened or its position set, the binary G-code decoder restarts @advi3++
+         , file_opened:1        // The file was opened, the synchronizations of the previous one are forgotten @advi3++
+       #endif
     ;
 } card_flags_t;
 
@@ -245,10 +253,15 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+  #if ENABLED(SD_STREAM) // @advi3++
+    static int16_t get()                          { const int16_t out = SdStream::get(); sdpos = SdStream::position(); return out; }
+    static void prefetch()                        { SdStream::prefetch(); }
+  #else
+    static int16_t get()                          { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+  #endif
   static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
   static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); TERN_(SD_STREAM, SdStream::seek(index)); TERN_(BINARY_GCODE, flag.sdpos_changed = true); }
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -65,4 +65,12 @@ public:
   virtual bool isReady() = 0;
 
   virtual void idle() = 0;
+
+  /**
+   * @advi3++ Let block writes return before the end of the flashing (SD_WRITE_BEHIND).
+   * Disabling it waits for the last write and checks its status.
+   *
+   * \return false if the last write failed.
+   */
+  virtual bool writeBehind(const bool) { return true; }
 };
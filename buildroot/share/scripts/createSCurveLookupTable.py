@@ -0,0 +1,48 @@
+#!/usr/bin/env python
+#
+# Marlin 3D Printer Firmware
+# Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+#
+# Based on Sprinter and grbl.
+# Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+from __future__ import print_function
+from __future__ import division
+
+""" Generate the S-curve acceleration lookup table for Marlin firmware (S_CURVE_TABLE). """
+
+import argparse
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument('-b', '--bits', type=int, default=6, help='Number of bits of the table index (default=6, 65 entries)')
+args = parser.parse_args()
+
+size = 1 << args.bits
+
+# Normalized quintic profile: same curve as the Bézier used by S_CURVE_ACCELERATION
+# (zero acceleration and jerk at both ends), scaled to Q16 and saturated to 16 bits.
+def s(t):
+    return 10 * t**3 - 15 * t**4 + 6 * t**5
+
+a = [ min(0xFFFF, int(round(0x10000 * s(i / size)))) for i in range(size + 1) ]
+
+print("#define S_CURVE_TABLE_BITS %d" % args.bits)
+print()
+print("const uint16_t s_curve_lookuptable[%d] PROGMEM = {" % (size + 1))
+for i in range(0, size + 1, 8):
+    print("  " + " ".join("%5d," % v for v in a[i:i + 8]))
+print("};")
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+#
+# Marlin 3D Printer Firmware
+# Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+#
+# Based on Sprinter and grbl.
+# Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+""" Convert a G-code file into a pre-tokenized binary G-code file (.GCB) for Marlin firmware (BINARY_GCODE). """
+
+import argparse
+import os
+import re
+import sys
+from decimal import Decimal
+
+# Keep in sync with Marlin/src/gcode/binary_gcode.h
+MAGIC = bytes([0xB9, ord('G'), ord('C'), ord('B'), 0x01])
+RECORD_COMMON = 0x80
+RECORD_OTHER = 0xFE
+RECORD_SYNC = 0xFF
+LETTERS = "XYZEFSIJRPTABCDGHKLMNOQUVW"
+DECIMALS = dict(zip("ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+                    [3, 3, 3, 3, 5, 1, 3, 3, 4, 4, 3, 3, 3, 3, 3, 2, 3, 4, 2, 0, 3, 3, 3, 3, 3, 3]))
+DELTAS = "XYZEF"
+COMMON_COMMANDS = [
+    ('G', 0), ('G', 1), ('G', 2), ('G', 3), ('G', 4), ('G', 10), ('G', 11), ('G', 28),
+    ('G', 29), ('G', 90), ('G', 91), ('G', 92), ('M', 73), ('M', 82), ('M', 83), ('M', 84),
+    ('M', 104), ('M', 105), ('M', 106), ('M', 107), ('M', 109), ('M', 140), ('M', 190), ('M', 204),
+    ('M', 205), ('M', 220), ('M', 221), ('M', 400), ('T', 0)
+]
+MAX_VALUES = (96 - 13) // 4     # MAX_CMD_SIZE and BinaryGCode::HEADER_SIZE
+
+# Commands using string_arg or parsed before GCodeParser (SD control, repeat markers): kept as text
+TEXT_COMMANDS = {0, 1, 16, 23, 24, 25, 26, 27, 28, 29, 30, 32, 33, 75, 117, 118, 524, 808, 928} | set(range(810, 820))
+
+COMMAND_RE = re.compile(r'([GMT])(\d+)(?:\.(\d+))?')
+PARAM_RE = re.compile(r'([A-Z])([-+]?(?:\d+\.?\d*|\.\d+))?')
+NUMBER_LIMIT = 1 << 31          # The decoder accumulates the values in an int32_t and reads them as zigzag uint32_t
+
+
+def varint(v):
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if v:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return out
+
+
+def zigzag(v):
+    return v << 1 if v >= 0 else ((-v) << 1) - 1
+
+
+def strip(line):
+    """ Remove comments, checksums and line numbers, like GCodeQueue does. """
+    line = line.split(';', 1)[0].split('*', 1)[0].strip()
+    return re.sub(r'^N\d+\s*', '', line)
+
+
+def fixed(letter, text):
+    """ Fixed-point value of a parameter or None if it has too many decimals or is too large. """
+    value = Decimal(text) * (10 ** DECIMALS[letter])
+    if value != value.to_integral_value() or abs(value) >= NUMBER_LIMIT:
+        return None
+    return int(value)
+
+
+class Encoder:
+    def __init__(self, sync):
+        self.sync = sync
+        self.previous = dict.fromkeys(DELTAS, 0)
+        self.records = 0
+        self.binary = 0
+        self.text = 0
+
+    def sync_record(self):
+        self.previous = dict.fromkeys(DELTAS, 0)
+        return bytes([RECORD_SYNC])
+
+    def encode(self, line):
+        line = strip(line)
+        if not line:
+            return b''
+        out = bytearray()
+        if self.sync and self.records and self.records % self.sync == 0:
+            out += self.sync_record()
+        self.records += 1
+        record = self.tokenize(line)
+        if record is None:
+            self.text += 1
+            return bytes(out) + line.encode('ascii', 'replace') + b'\n'
+        self.binary += 1
+        return bytes(out) + record
+
+    def tokenize(self, line):
+        command = COMMAND_RE.match(line)
+        if not command:
+            return None
+        letter, codenum, subcode = command.group(1), int(command.group(2)), int(command.group(3) or 0)
+        if (letter == 'M' and codenum in TEXT_COMMANDS) or codenum > 0xFFFF or subcode > 0xFF:
+            return None
+
+        params = {}
+        rest = line[command.end():].replace(' ', '')
+        pos = 0
+        while pos < len(rest):
+            m = PARAM_RE.match(rest, pos)
+            if not m or m.group(1) in params:
+                return None
+            value = None
+            if m.group(2) is not None:
+                value = fixed(m.group(1), m.group(2))
+                if value is None:
+                    return None
+            params[m.group(1)] = value
+            pos = m.end()
+        if sum(v is not None for v in params.values()) > MAX_VALUES:
+            return None
+
+        # X, Y, Z, E and F are coded as differences with their previous value
+        encoded = {l: v - self.previous[l] if l in DELTAS and v is not None else v for l, v in params.items()}
+        if any(v is not None and abs(v) >= NUMBER_LIMIT for v in encoded.values()):
+            return None
+
+        out = bytearray()
+        if subcode == 0 and (letter, codenum) in COMMON_COMMANDS:
+            out.append(RECORD_COMMON + COMMON_COMMANDS.index((letter, codenum)))
+        else:
+            out.append(RECORD_OTHER)
+            out.append(ord(letter))
+            out += varint(codenum)
+            out.append(subcode)
+
+        present = valued = 0
+        for l in params:
+            bit = 1 << LETTERS.index(l)
+            present |= bit
+            if params[l] is not None:
+                valued |= bit
+        out += varint(present)
+        out += varint(valued)
+
+        for l in sorted(params):    # Values are in alphabetical order
+            if params[l] is None:
+                continue
+            if l in DELTAS:
+                self.previous[l] = params[l]
+            out += varint(zigzag(encoded[l]))
+        return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('input', help='G-code file')
+    parser.add_argument('output', nargs='?', help='Binary G-code file (default: input with the .gcb extension)')
+    parser.add_argument('-s', '--sync', type=int, default=256,
+                        help='Number of commands between synchronization records (default=256, 0 for none)')
+    args = parser.parse_args()
+
+    output = args.output or os.path.splitext(args.input)[0] + '.gcb'
+    encoder = Encoder(args.sync)
+    size = 0
+    with open(args.input, 'r', encoding='latin-1') as src, open(output, 'wb') as dst:
+        dst.write(MAGIC)
+        for line in src:
+            size += len(line)
+            dst.write(encoder.encode(line))
+
+    converted = os.path.getsize(output)
+    print("%s: %d commands (%d binary, %d text), %d -> %d bytes (%.1fx)" %
+          (output, encoder.records, encoder.binary, encoder.text, size, converted, size / max(converted, 1)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+#
+# Marlin 3D Printer Firmware
+# Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+#
+# Based on Sprinter and grbl.
+# Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+""" Upload a file to the SD card of Marlin with the binary file transfer protocol (BINARY_FILE_TRANSFER, M28 B1).
+
+The data is compressed with heatshrink (pip install heatshrink2) and sent in packets checked by a checksum.
+The file can be printed at the end of the transfer (M23 and M24).
+"""
+
+import argparse
+import os
+import sys
+import time
+
+import MarlinBinaryProtocol
+
+
+def sd_name(path):
+    """ 8.3 name on the SD card (openFileWrite does not create long file names). """
+    stem, ext = os.path.splitext(os.path.basename(path))
+    stem = ''.join(c for c in stem.upper() if c.isalnum() or c in '_-')[:8] or 'UPLOAD'
+    return stem + ext.upper()[:4]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('port', help='Serial port of the printer (e.g. /dev/ttyUSB0)')
+    parser.add_argument('file', help='File to upload')
+    parser.add_argument('name', nargs='?', help='Name on the SD card (default: 8.3 name derived from the file)')
+    parser.add_argument('-b', '--baud', type=int, default=115200, help='Baud rate (default=115200)')
+    parser.add_argument('-s', '--block-size', type=int, default=512,
+                        help='Maximal size of the packets, limited by the firmware (default=512)')
+    parser.add_argument('-t', '--timeout', type=int, default=1000, help='Response timeout in ms (default=1000)')
+    parser.add_argument('-n', '--no-compression', action='store_true', help='Send the data as it is')
+    parser.add_argument('-d', '--dummy', action='store_true', help='Transfer without writing to the SD card')
+    parser.add_argument('-p', '--print', action='store_true', help='Print the file after the transfer')
+    parser.add_argument('-e', '--errors', type=float, default=0.0, help='Ratio of packets to corrupt (for tests)')
+    args = parser.parse_args()
+
+    name = args.name or sd_name(args.file)
+    size = os.path.getsize(args.file)
+
+    protocol = MarlinBinaryProtocol.Protocol(args.port, args.baud, args.block_size, args.errors, args.timeout)
+    transfer = MarlinBinaryProtocol.FileTransferProtocol(protocol)
+    success = False
+    try:
+        protocol.connect()
+        start = time.time()
+        success = transfer.copy(args.file, name, not args.no_compression, args.dummy)
+        duration = time.time() - start
+        protocol.disconnect()
+
+        if success:
+            print("%s: %d bytes in %.1f s (%.2f KB/s), %d errors" %
+                  (name, size, duration, size / max(duration, 0.001) / 1000, protocol.errors))
+            if args.print and not args.dummy:
+                protocol.send_ascii('M23 ' + name)
+                protocol.send_ascii('M24')
+    except KeyboardInterrupt:
+        transfer.abort()
+        protocol.disconnect()
+    except (MarlinBinaryProtocol.FatalError, MarlinBinaryProtocol.ConnectionLost,
+            MarlinBinaryProtocol.ReadTimeout, MarlinBinaryProtocol.SycronisationError) as e:
+        print("Transfer failed: %s" % type(e).__name__)
+    finally:
+        protocol.shutdown()
+
+    return 0 if success else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
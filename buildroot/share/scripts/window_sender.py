@@ -0,0 +1,401 @@
+#!/usr/bin/env python3
+#
+# Marlin 3D Printer Firmware
+# Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+#
+# Based on Sprinter and grbl.
+# Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+""" Stream a G-code file to Marlin keeping several commands in flight (sliding window driven by ADVANCED_OK).
+
+With --simulate, the file is sent to a stand-in of the firmware (serial line, RX buffer, XON/XOFF, command queue,
+line numbers and checksums) and the script checks that every command is executed once and in order.
+"""
+
+import argparse
+import random
+import re
+import sys
+import time
+from collections import deque
+
+OK_RE = re.compile(r'^ok(?: N(\d+))?(?: P(\d+))?(?: B(\d+))?')
+RESEND_RE = re.compile(r'^(?:Resend|rs):?\s*N?(\d+)', re.IGNORECASE)
+
+# Keep in sync with the firmware configuration (Configuration.h and Configuration_adv.h)
+MAX_CMD_SIZE = 96
+COMMAND_QUEUE_SIZE = 384
+ENTRY_HEADER_SIZE = 6           # CommandLine header (PACKED_COMMAND_QUEUE), with POWER_LOSS_RECOVERY
+INDEX_HEADER_SIZE = 8           # GCodeIndex::PACKED_HEADER_SIZE, offsets of the command and of '*'
+
+MAX_ENTRY_SIZE = ENTRY_HEADER_SIZE + MAX_CMD_SIZE + 1
+BLOCKING_COMMANDS = {'G4', 'G28', 'G29', 'M109', 'M190', 'M400'}
+
+
+def strip(line):
+    """ Remove comments and spaces around the command. """
+    return line.split(';', 1)[0].strip()
+
+
+def checksum(text):
+    cs = 0
+    for c in text.encode('ascii', 'replace'):
+        cs ^= c
+    return cs
+
+
+def numbered(n, command):
+    text = "N%d %s" % (n, command)
+    return ("%s*%d\n" % (text, checksum(text))).encode('ascii', 'replace')
+
+
+class WindowSender:
+    """ Send numbered lines while the window (lines in flight) and the RX budget (bytes in flight) allow it.
+
+    Each "ok N<n> P<p> B<b>" acknowledges all the lines up to N. Without ADVANCED_OK (no N in ok), each ok
+    acknowledges the oldest line and only one line is in flight. The window is learned from the B value of the
+    first ok (free command slots while M110 is executed, + 1 for M110 itself).
+    """
+
+    def __init__(self, port, commands, window=None, rx_size=128, xonxoff=False, timeout=10.0, settle=0.05):
+        self.port = port
+        self.commands = commands
+        self.window = window
+        self.learn_window = window is None
+        self.budget = None if xonxoff else rx_size - 1
+        self.timeout = timeout
+        self.settle = settle
+        self.hold_until = 0.0       # After a Resend, wait until the lines in flight are rejected or flushed
+        self.advanced = False
+        self.in_flight = deque()    # (line number, bytes)
+        self.in_flight_bytes = 0
+        self.next = 0               # Line number of the next line to send (0 is M110 N0)
+        self.rewind = None          # Line number of the last Resend, until it is acknowledged
+        self.resends = 0
+        self.timeouts = 0
+
+    def line(self, n):
+        return numbered(n, "M110 N0" if n == 0 else self.commands[n - 1])
+
+    def window_size(self):
+        return self.window if self.advanced and self.window else 1
+
+    def can_send(self):
+        if self.next > len(self.commands) or len(self.in_flight) >= self.window_size():
+            return False
+        if self.port.now() < self.hold_until:
+            return False
+        if self.budget is None or not self.in_flight:
+            return True
+        return self.in_flight_bytes + len(self.line(self.next)) <= self.budget
+
+    def send(self):
+        data = self.line(self.next)
+        self.port.write(data)
+        self.in_flight.append((self.next, data))
+        self.in_flight_bytes += len(data)
+        self.next += 1
+
+    def acknowledge(self, n):
+        while self.in_flight and self.in_flight[0][0] <= n:
+            self.in_flight_bytes -= len(self.in_flight.popleft()[1])
+        if self.rewind is not None and n >= self.rewind:
+            self.rewind = None
+
+    def resend(self, n):
+        # The lines in flight when the first Resend was sent are rejected (same Resend) or flushed by the firmware.
+        # Ignore them and wait until they stop coming before sending again.
+        if n == self.rewind:
+            self.hold_until = self.port.now() + self.settle
+            return
+        if not self.in_flight or n < self.in_flight[0][0]:
+            return
+        self.hold_until = self.port.now() + self.settle
+        self.resends += 1
+        self.rewind = n
+        self.acknowledge(n - 1)
+        self.in_flight.clear()
+        self.in_flight_bytes = 0
+        self.next = n
+
+    def received(self, text):
+        ok = OK_RE.match(text)
+        if ok:
+            if ok.group(1) is not None:
+                self.advanced = True
+                if self.learn_window and ok.group(3) is not None:
+                    self.window = max(1, int(ok.group(3)) + 1)
+                    self.learn_window = False
+                self.acknowledge(int(ok.group(1)))
+            elif not self.advanced and self.in_flight:
+                self.acknowledge(self.in_flight[0][0])
+            return
+        resend = RESEND_RE.match(text)
+        if resend:
+            self.resend(int(resend.group(1)))
+
+    def run(self):
+        last = self.port.now()
+        while self.next <= len(self.commands) or self.in_flight:
+            while self.can_send():
+                self.send()
+            text = self.port.readline()
+            if text is not None:
+                last = self.port.now()
+                self.received(text)
+            elif self.port.now() - last > self.timeout and self.in_flight:
+                # Nothing received for a while: send again from the oldest line not acknowledged
+                self.timeouts += 1
+                last = self.port.now()
+                self.rewind = None
+                self.resend(self.in_flight[0][0])
+
+
+class SerialPort:
+    """ A real serial port (requires pyserial). """
+
+    def __init__(self, device, baudrate, xonxoff):
+        import serial
+        self.serial = serial.Serial(device, baudrate, timeout=0.1, xonxoff=xonxoff)
+
+    def write(self, data):
+        self.serial.write(data)
+
+    def readline(self):
+        line = self.serial.readline()
+        return line.decode('ascii', 'replace').strip() if line else None
+
+    @staticmethod
+    def now():
+        return time.monotonic()
+
+
+class StandInPrinter:
+    """ Stand-in of the firmware and of the serial line between the host and the firmware.
+
+    The simulation advances by the time of one byte on the serial line. The host lines are delivered byte by byte
+    after the USB latency, into the RX buffer (dropped if it is full). Like Marlin, the main loop reads the RX buffer
+    only between two commands, and only while the command queue has room for a maximal command.
+    """
+
+    def __init__(self, baudrate=250000, latency=0.002, rx_size=128, xonxoff=False, errors=0.0,
+                 move_time=0.0015, blocking_time=0.2, seed=1):
+        self.byte_time = 10.0 / baudrate
+        self.latency = latency
+        self.rx_size = rx_size
+        self.xonxoff = xonxoff
+        self.errors = errors
+        self.move_time = move_time
+        self.blocking_time = blocking_time
+        self.random = random.Random(seed)
+
+        self.time = 0.0
+        self.to_printer = deque()   # Bytes on the way to the printer (time when ready, byte)
+        self.to_host = deque()      # Lines on the way to the host (time when ready, text)
+        self.wire_free = 0.0        # Time when the host side of the line is free
+        self.paused_until = None    # XOFF received by the host
+        self.xoff = False
+
+        self.rx = deque()
+        self.line = bytearray()
+        self.last_n = 0
+        self.queue = deque()        # (line number, command, size in the queue)
+        self.queue_bytes = 0
+        self.busy_until = 0.0
+        self.processing = None
+        self.executed = []
+        self.dropped = 0
+        self.max_rx = 0
+
+    # Host side
+
+    def write(self, data):
+        if self.errors and self.random.random() < self.errors:
+            data = bytearray(data)
+            data[self.random.randrange(len(data) - 1)] ^= 0x04
+        start = max(self.time + self.latency, self.wire_free)
+        for i, c in enumerate(data):
+            self.to_printer.append((start + i * self.byte_time, c))
+        self.wire_free = start + len(data) * self.byte_time
+
+    def readline(self, timeout=0.05):
+        end = self.time + timeout
+        while self.time < end:
+            if self.to_host and self.to_host[0][0] <= self.time:
+                return self.to_host.popleft()[1]
+            self.step()
+        return None
+
+    def now(self):
+        return self.time
+
+    # Printer side
+
+    def output(self, text):
+        # TX_BUFFER_SIZE is 0: the main loop is blocked while the characters are sent
+        duration = (len(text) + 1) * self.byte_time
+        self.busy_until = max(self.busy_until, self.time) + duration
+        self.to_host.append((self.busy_until + self.latency, text))
+
+    def receive(self):
+        if self.to_printer and self.to_printer[0][0] <= self.time:
+            if self.paused_until is not None and self.time >= self.paused_until:
+                # The host stopped sending: delay the remaining bytes
+                shift = self.byte_time
+                self.to_printer = deque((t + shift, c) for t, c in self.to_printer)
+                self.wire_free += shift
+                return
+            c = self.to_printer.popleft()[1]
+            if len(self.rx) >= self.rx_size - 1:
+                self.dropped += 1
+                return
+            self.rx.append(c)
+            self.max_rx = max(self.max_rx, len(self.rx))
+            if self.xonxoff and not self.xoff and len(self.rx) >= self.rx_size // 8:
+                self.xoff = True
+                self.paused_until = self.time + self.latency
+
+    def read_rx(self):
+        c = self.rx.popleft()
+        if self.xonxoff and self.xoff and len(self.rx) < self.rx_size // 10:
+            self.xoff = False
+            self.paused_until = None
+        return c
+
+    def room(self):
+        return COMMAND_QUEUE_SIZE - self.queue_bytes >= MAX_ENTRY_SIZE
+
+    def free_commands(self):
+        return (COMMAND_QUEUE_SIZE - self.queue_bytes) // MAX_ENTRY_SIZE
+
+    def error(self, message):
+        self.output("Error:" + message)
+        self.output("Resend: %d" % (self.last_n + 1))
+        self.output("ok")
+        self.rx.clear()
+        self.line.clear()
+        self.xoff = False
+        self.paused_until = None
+
+    def line_done(self):
+        text = self.line.decode('ascii', 'replace').strip()
+        self.line.clear()
+        if not text:
+            return
+        match = re.match(r'^N(\d+)\s+(.*)\*(\d+)$', text)
+        if not match:
+            self.error("No Checksum with line number, Last Line: %d" % self.last_n)
+            return
+        n, command, cs = int(match.group(1)), match.group(2), int(match.group(3))
+        if n != self.last_n + 1 and not command.startswith('M110'):
+            self.error("Line Number is not Last Line Number+1, Last Line: %d" % self.last_n)
+            return
+        if checksum(text[:text.rindex('*')]) != cs:
+            self.error("checksum mismatch, Last Line: %d" % self.last_n)
+            return
+        self.last_n = n
+        size = ENTRY_HEADER_SIZE + len(text) + 1 + INDEX_HEADER_SIZE + len(re.findall(r'[A-Z]', command[1:]))
+        self.queue.append((n, command, size))
+        self.queue_bytes += size
+
+    def loop(self):
+        if self.processing is not None:
+            n, command, size = self.processing
+            self.processing = None
+            if not command.startswith('M110'):
+                self.executed.append(command)
+            self.output("ok N%d P15 B%d" % (n, self.free_commands()))
+            self.queue_bytes -= size
+            return
+
+        while self.rx and self.room():
+            c = self.read_rx()
+            if c == ord('\n'):
+                self.line_done()
+                if self.busy_until > self.time:
+                    return
+            else:
+                self.line.append(c)
+
+        if self.queue:
+            self.processing = self.queue.popleft()
+            blocking = self.processing[1].split(' ', 1)[0] in BLOCKING_COMMANDS
+            self.busy_until = self.time + (self.blocking_time if blocking else self.move_time)
+
+    def step(self):
+        self.time += self.byte_time
+        self.receive()
+        if self.time >= self.busy_until:
+            self.loop()
+
+
+def simulate(commands, args):
+    results = []
+    for window in (1, args.window):
+        printer = StandInPrinter(args.baudrate, args.latency, args.rx_size, args.xonxoff, args.errors)
+        sender = WindowSender(printer, commands, window, args.rx_size, args.xonxoff)
+        sender.run()
+        if printer.executed != commands:
+            print("Window %s: the commands executed are not the commands sent" % window)
+            return 1
+        results.append(printer.time)
+        print("Window %-2d %d commands in %.3f s (%.0f commands/s), %d resends, %d timeouts, "
+              "%d dropped bytes, max RX %d bytes" %
+              (sender.window or 1, len(commands), printer.time, len(commands) / printer.time,
+               sender.resends, sender.timeouts, printer.dropped, printer.max_rx))
+    print("Speedup: %.2fx" % (results[0] / results[1]))
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='G-code file')
+    parser.add_argument('-p', '--port', help='Serial port of the printer')
+    parser.add_argument('-b', '--baudrate', type=int, default=115200, help='Baud rate (default=115200)')
+    parser.add_argument('-w', '--window', type=int,
+                        help='Maximal number of lines in flight (default: learned from the first ok)')
+    parser.add_argument('-r', '--rx-size', type=int, default=128,
+                        help='RX_BUFFER_SIZE of the firmware, limits the bytes in flight (default=128)')
+    parser.add_argument('-x', '--xonxoff', action='store_true',
+                        help='XON/XOFF flow control (SERIAL_XON_XOFF): the bytes in flight are not limited')
+    parser.add_argument('-s', '--simulate', action='store_true',
+                        help='Send to a stand-in of the firmware, with one line and with a window')
+    parser.add_argument('-l', '--latency', type=float, default=0.002, help='Simulated USB latency (default=0.002 s)')
+    parser.add_argument('-e', '--errors', type=float, default=0.0,
+                        help='Simulated probability of a corrupted line (default=0)')
+    args = parser.parse_args()
+
+    with open(args.input, 'r', encoding='latin-1') as src:
+        commands = [c for c in (strip(line) for line in src) if c]
+
+    if args.simulate:
+        return simulate(commands, args)
+    if not args.port:
+        parser.error('a serial port (--port) is required without --simulate')
+
+    port = SerialPort(args.port, args.baudrate, args.xonxoff)
+    sender = WindowSender(port, commands, args.window, args.rx_size, args.xonxoff)
+    start = time.monotonic()
+    sender.run()
+    duration = time.monotonic() - start
+    print("%d commands in %.1f s (%.0f commands/s), window %d, %d resends" %
+          (len(commands), duration, len(commands) / max(duration, 1e-6), sender.window_size(), sender.resends))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -33,5 +33,11 @@ using byte = uint8_t;
 #define lowByte(w) ((uint8_t) ((w) & 0xff))
 #define highByte(w) ((uint8_t) ((w) >> 8))
 
+#define FORCE_INLINE inline
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_float(addr) (*(const float *)(addr))
+
 inline void delay(unsigned long ms) {}
 
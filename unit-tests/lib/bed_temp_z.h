@@ -0,0 +1,32 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include "../lib/avr/macros.h"
+#include <cstdint>
+
+// Definitions of Marlin (types.h and Configuration_adv.h) used by the bed temperature Z compensation
+typedef int16_t celsius_t;
+#define BED_TEMP_Z_START 50
+#define BED_TEMP_Z_RES 10
+#define BED_TEMP_Z_COUNT 7
+
+#include "../../Marlin/src/feature/bedlevel/abl/bed_temp_z.h"
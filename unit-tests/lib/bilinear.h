@@ -0,0 +1,32 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include "../lib/avr/macros.h"
+#include <cmath>
+#include <cstdint>
+
+// Definitions of Marlin (macros.h) used by the bilinear coefficients
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+using std::isnan;
+
+#include "../../Marlin/src/feature/bedlevel/abl/bilinear_coefficients.h"
+#include "../../Marlin/src/feature/bedlevel/abl/leveled_segments.h"
@@ -0,0 +1,55 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include "../lib/avr/macros.h"
+#include <algorithm>
+#include <cstddef>
+
+// Definitions of Marlin (types.h, thermistors.h, temperature.h) with the ADVi3++ configuration
+typedef uint16_t raw_adc_t;
+typedef int16_t celsius_t;
+typedef float celsius_float_t;
+typedef struct { raw_adc_t value; celsius_t celsius; } temp_entry_t;
+typedef struct { float p, i, d; } raw_pid_t;
+typedef struct { float p, i, d, c, f; } raw_pidcf_t;
+
+#define _BV(b) (1 << (b))
+#define _MIN(a, b) std::min(a, b)
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define OVERSAMPLENR 16
+#define OV(N) raw_adc_t(float(N) * (OVERSAMPLENR))
+#define MAX_RAW_THERMISTOR_VALUE (uint16_t(1024) * (OVERSAMPLENR) - 1)
+#define THERMISTOR_LUT_SHIFT 6
+
+#define PID_FUNCTIONAL_RANGE 10
+#define PID_K1 0.95
+#define PID_K2 (1.0f - float(PID_K1))
+#define PID_dT ((OVERSAMPLENR * float(10)) / (977))
+#define scalePID_i(i)   ( float(i) * PID_dT )
+#define unscalePID_i(i) ( float(i) / PID_dT )
+#define scalePID_d(d)   ( float(d) / PID_dT )
+#define unscalePID_d(d) ( float(d) * PID_dT )
+
+#include "../../Marlin/src/module/thermistor/thermistor_1.h"
+#include "../../Marlin/src/module/thermistor/thermistor_lut.h"
+#include "../../Marlin/src/module/pid_fixed.h"
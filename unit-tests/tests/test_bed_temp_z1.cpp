@@ -0,0 +1,102 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include "../lib/bed_temp_z.h"
+
+namespace {
+
+// Bed rising of 15 µm each 10 °C from 50 to 110 °C
+BedTempZ make_model(celsius_t mesh_temp) {
+  BedTempZ temp_z;
+  temp_z.reset();
+  for(uint8_t i = 0; i < BedTempZ::COUNT; ++i) temp_z.set_z(i, 15 * i);
+  temp_z.set_mesh_temp(mesh_temp);
+  return temp_z;
+}
+
+}
+
+SCENARIO("Bed temperature Z compensation", "[bed_temp_z]")
+{
+  GIVEN("A reset model")
+  {
+    BedTempZ temp_z;
+    temp_z.reset();
+
+    THEN("There is no offset")
+    {
+      for(celsius_t temp = 0; temp <= 150; temp += 5)
+        REQUIRE(temp_z.offset(temp) == 0);
+    }
+  }
+
+  GIVEN("A model measured from 50 to 110 °C and a mesh probed at 60 °C")
+  {
+    BedTempZ temp_z = make_model(60);
+
+    THEN("The temperatures are the ones of the configuration")
+    {
+      REQUIRE(BedTempZ::temperature(0) == 50);
+      REQUIRE(BedTempZ::temperature(BedTempZ::COUNT - 1) == 110);
+    }
+
+    THEN("Heights are interpolated between the temperatures")
+    {
+      REQUIRE(temp_z.height(50) == 0);
+      REQUIRE(temp_z.height(65) == 22);
+      REQUIRE(temp_z.height(100) == 75);
+      REQUIRE(temp_z.height(104) == 81);
+    }
+
+    THEN("Heights are constant beyond the temperatures")
+    {
+      REQUIRE(temp_z.height(0) == 0);
+      REQUIRE(temp_z.height(20) == 0);
+      REQUIRE(temp_z.height(110) == 90);
+      REQUIRE(temp_z.height(150) == 90);
+    }
+
+    THEN("The offset is relative to the temperature of the mesh")
+    {
+      REQUIRE(temp_z.offset(60) == 0);
+      REQUIRE(std::fabs(temp_z.offset(110) - 0.075f) < 1e-6f);
+      REQUIRE(std::fabs(temp_z.offset(50) + 0.015f) < 1e-6f);
+    }
+
+    THEN("The offset is computed again when the model changes")
+    {
+      REQUIRE(std::fabs(temp_z.offset(110) - 0.075f) < 1e-6f);
+      temp_z.set_mesh_temp(110);
+      REQUIRE(temp_z.offset(110) == 0);
+      temp_z.set_z(BedTempZ::COUNT - 1, 150);
+      REQUIRE(std::fabs(temp_z.offset(60) + 0.135f) < 1e-6f);
+      BedTempZ::Data data = temp_z.data();
+      data.mesh_temp = 60;
+      temp_z.set(data);
+      REQUIRE(temp_z.offset(60) == 0);
+      temp_z.reset();
+      REQUIRE(temp_z.offset(110) == 0);
+    }
+  }
+}
@@ -0,0 +1,203 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cmath>
+#include <vector>
+#include "../lib/bilinear.h"
+
+namespace {
+
+struct Point { float x, y; };
+
+// LevelingBilinear::get_z_correction of feature/bedlevel/abl/bbl.cpp (floats, with its caches)
+template<uint8_t POINTS_X, uint8_t POINTS_Y, bool EXTRAPOLATE>
+struct FloatBilinear {
+  float z_values[POINTS_X][POINTS_Y];
+  Point grid_start, grid_factor;
+  Point cached_rel{-999.999f, -999.999f};
+  int8_t cached_gx = -99, cached_gy = -99;
+  float z1 = 0, d2 = 0, z3 = 0, d4 = 0, L = 0, D = 0;
+  Point ratio{};
+  int8_t thisgx = 0, thisgy = 0, nextgx = 0, nextgy = 0;
+
+  float get_z_correction(const Point &raw) {
+    const Point rel{raw.x - grid_start.x, raw.y - grid_start.y};
+    constexpr int FAR_EDGE_OR_BOX = EXTRAPOLATE ? 2 : 1;
+
+    if (cached_rel.x != rel.x) {
+      cached_rel.x = rel.x;
+      ratio.x = rel.x * grid_factor.x;
+      const float gx = constrain(std::floor(ratio.x), 0, POINTS_X - FAR_EDGE_OR_BOX);
+      ratio.x -= gx;
+      if (!EXTRAPOLATE && ratio.x < 0) ratio.x = 0;
+      thisgx = gx;
+      nextgx = std::min(thisgx + 1, POINTS_X - 1);
+    }
+
+    if (cached_rel.y != rel.y || cached_gx != thisgx) {
+      if (cached_rel.y != rel.y) {
+        cached_rel.y = rel.y;
+        ratio.y = rel.y * grid_factor.y;
+        const float gy = constrain(std::floor(ratio.y), 0, POINTS_Y - FAR_EDGE_OR_BOX);
+        ratio.y -= gy;
+        if (!EXTRAPOLATE && ratio.y < 0) ratio.y = 0;
+        thisgy = gy;
+        nextgy = std::min(thisgy + 1, POINTS_Y - 1);
+      }
+
+      if (cached_gx != thisgx || cached_gy != thisgy) {
+        cached_gx = thisgx;
+        cached_gy = thisgy;
+        z1 = z_values[thisgx][thisgy];
+        d2 = z_values[thisgx][nextgy] - z1;
+        z3 = z_values[nextgx][thisgy];
+        d4 = z_values[nextgx][nextgy] - z3;
+      }
+
+      L = z1 + d2 * ratio.y;
+      const float R = z3 + d4 * ratio.y;
+      D = R - L;
+    }
+
+    return L + ratio.x * D;
+  }
+};
+
+template<uint8_t POINTS_X, uint8_t POINTS_Y, bool EXTRAPOLATE>
+struct Mesh {
+  FloatBilinear<POINTS_X, POINTS_Y, EXTRAPOLATE> reference;
+  BilinearCoefficients<POINTS_X - 1, POINTS_Y - 1, EXTRAPOLATE> coefficients;
+
+  Mesh(const Point &start, const Point &spacing, float amplitude) {
+    reference.grid_start = start;
+    reference.grid_factor = {1 / spacing.x, 1 / spacing.y};
+    for(uint8_t x = 0; x < POINTS_X; ++x)
+      for(uint8_t y = 0; y < POINTS_Y; ++y)
+        reference.z_values[x][y] = amplitude * std::sin(x * 1.7f + y * 0.9f) + 0.002f * x * y;
+    coefficients.set([this](uint8_t x, uint8_t y) { return reference.z_values[x][y]; });
+  }
+
+  float get_z_correction(const Point &raw) const {
+    return coefficients.get((raw.x - reference.grid_start.x) * reference.grid_factor.x,
+                            (raw.y - reference.grid_start.y) * reference.grid_factor.y);
+  }
+
+  float max_error(const std::vector<Point> &path) {
+    float error = 0;
+    for(const auto &p: path) error = std::max(error, std::fabs(get_z_correction(p) - reference.get_z_correction(p)));
+    return error;
+  }
+};
+
+// Toolpath of a print on the bed of the Wanhao i3 Plus, as segmented by the planner:
+// perimeters of a cylinder and a zigzag infill, then a skirt and moves around the whole bed
+std::vector<Point> toolpath() {
+  std::vector<Point> path;
+  for(int layer = 0; layer < 5; ++layer) {
+    for(int i = 0; i <= 360; ++i) {
+      const float a = i * 3.14159265f / 180;
+      path.push_back({100 + 60 * std::cos(a), 100 + 60 * std::sin(a)});
+    }
+    for(float y = 45; y <= 155; y += 0.4f) {
+      const float x0 = 100 - std::sqrt(std::max(0.0f, 55 * 55 - (y - 100) * (y - 100)));
+      const float x1 = 200 - x0;
+      for(float x = x0; x <= x1; x += 5) path.push_back({(int(y * 2.5f) & 1) ? 200 - x : x, y});
+    }
+  }
+  for(float t = 0; t <= 200; t += 0.5f) {
+    path.push_back({t, 0});
+    path.push_back({200, t});
+    path.push_back({t, t});
+  }
+  return path;
+}
+
+}
+
+SCENARIO("Bilinear leveling with precomputed coefficients", "[bilinear]")
+{
+  const std::vector<Point> path = toolpath();
+
+  GIVEN("A 3x3 mesh probed inside the bed")
+  {
+    Mesh<3, 3, false> mesh({30, 30}, {70, 70}, 0.3f);
+
+    THEN("The corrections are the ones of the float interpolation, within 2 microns")
+    {
+      REQUIRE(mesh.max_error(path) <= 0.002f);
+    }
+
+    THEN("The grid points are exact, within the resolution of 1/1024 mm")
+    {
+      for(uint8_t x = 0; x < 3; ++x)
+        for(uint8_t y = 0; y < 3; ++y)
+          REQUIRE(std::fabs(mesh.get_z_correction({30.0f + x * 70, 30.0f + y * 70}) - mesh.reference.z_values[x][y]) <= 0.5f / 1024);
+    }
+
+    THEN("The height of the edges is kept beyond the grid")
+    {
+      REQUIRE(mesh.get_z_correction({0, 0}) == mesh.get_z_correction({30, 30}));
+      REQUIRE(mesh.get_z_correction({200, 100}) == mesh.get_z_correction({170, 100}));
+    }
+  }
+
+  GIVEN("A 5x5 mesh extrapolated beyond the grid")
+  {
+    Mesh<5, 5, true> mesh({30, 30}, {35, 35}, 1.0f);
+
+    THEN("The corrections are the ones of the float interpolation, within 2 microns")
+    {
+      REQUIRE(mesh.max_error(path) <= 0.002f);
+    }
+  }
+
+  GIVEN("A mesh with an unprobed point")
+  {
+    Mesh<3, 3, false> mesh({30, 30}, {70, 70}, 0.3f);
+    mesh.reference.z_values[1][1] = NAN;
+    mesh.coefficients.set([&mesh](uint8_t x, uint8_t y) { return mesh.reference.z_values[x][y]; });
+
+    THEN("The point is taken as 0")
+    {
+      REQUIRE(mesh.get_z_correction({100, 100}) == 0);
+    }
+  }
+}
+
+TEST_CASE("Bilinear leveling benchmark", "[bilinear][!benchmark]")
+{
+  const std::vector<Point> path = toolpath();
+  Mesh<3, 3, false> mesh({30, 30}, {70, 70}, 0.3f);
+
+  BENCHMARK("Float interpolation with caches") {
+    float sum = 0;
+    for(const auto &p: path) sum += mesh.reference.get_z_correction(p);
+    return sum;
+  };
+
+  BENCHMARK("Precomputed coefficients") {
+    float sum = 0;
+    for(const auto &p: path) sum += mesh.get_z_correction(p);
+    return sum;
+  };
+}
@@ -0,0 +1,351 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../lib/binary_gcode.h"
+
+namespace {
+
+const char LETTERS[] = "XYZEFSIJRPTABCDGHKLMNOQUVW";
+const std::vector<uint8_t> MAGIC = {0xB9, 'G', 'C', 'B', 0x01};
+
+struct Param { char letter; const char *text; };
+
+void varint(std::vector<uint8_t> &out, uint32_t v) {
+  while(v >= 0x80) { out.push_back(uint8_t(v) | 0x80); v >>= 7; }
+  out.push_back(uint8_t(v));
+}
+
+int decimals(char letter) {
+  switch(letter) {
+    case 'E': return 5; case 'F': return 1; case 'I': case 'J': case 'R': return 4;
+    case 'P': case 'S': return 2; case 'T': return 0; default: return 3;
+  }
+}
+
+// Minimal encoder (same format as buildroot/share/scripts/gcode2gcb.py). Parameters must be in alphabetical order.
+struct Encoder {
+  int32_t previous[26] = {};
+
+  void command(std::vector<uint8_t> &out, uint8_t record, const std::vector<Param> &params) {
+    out.push_back(record);
+    parameters(out, params);
+  }
+
+  void other(std::vector<uint8_t> &out, char letter, uint16_t codenum, const std::vector<Param> &params) {
+    out.insert(out.end(), {0xFE, uint8_t(letter)});
+    varint(out, codenum);
+    out.push_back(0); // subcode
+    parameters(out, params);
+  }
+
+  void parameters(std::vector<uint8_t> &out, const std::vector<Param> &params) {
+    uint32_t present = 0, valued = 0;
+    for(auto &p: params) {
+      const uint32_t bit = 1UL << (strchr(LETTERS, p.letter) - LETTERS);
+      present |= bit;
+      if(p.text) valued |= bit;
+    }
+    varint(out, present);
+    varint(out, valued);
+    for(auto &p: params) {
+      if(!p.text) continue;
+      int32_t v = int32_t(std::lround(std::strtod(p.text, nullptr) * std::pow(10, decimals(p.letter))));
+      if(strchr("XYZEF", p.letter)) { const int32_t d = v - previous[p.letter - 'A']; previous[p.letter - 'A'] = v; v = d; }
+      varint(out, v >= 0 ? uint32_t(v) << 1 : (uint32_t(-v) << 1) - 1);
+    }
+  }
+};
+
+struct Decoded {
+  std::string text;
+  std::vector<std::string> commands;
+  bool error = false;
+};
+
+// Feed bytes and collect the decoded commands (raw buffers) and the ASCII characters
+Decoded decode(BinaryGCode &decoder, const std::vector<uint8_t> &bytes) {
+  Decoded result;
+  char buffer[96];
+  for(auto c: bytes) {
+    switch(decoder.feed(c, buffer, sizeof(buffer))) {
+      case BinaryGCode::BGC_PASS: result.text += char(c); break;
+      case BinaryGCode::BGC_COMMAND: result.commands.emplace_back(buffer, sizeof(buffer)); break;
+      case BinaryGCode::BGC_ERROR: result.error = true; return result;
+      default: break;
+    }
+  }
+  return result;
+}
+
+// Value of a parameter in a decoded command, the same way GCodeParser::parse_binary does
+bool value(const std::string &command, char letter, float &v) {
+  const char *p = command.data();
+  const uint32_t codebits = BinaryGCode::codebits(p), valuebits = BinaryGCode::valuebits(p);
+  const uint8_t index = letter - 'A';
+  if(!(codebits & (1UL << index)) || !(valuebits & (1UL << index))) return false;
+  uint8_t offset = BinaryGCode::HEADER_SIZE;
+  for(uint8_t i = 0; i < index; ++i) if(valuebits & (1UL << i)) offset += sizeof(float);
+  v = BinaryGCode::value(p + offset);
+  return true;
+}
+
+}
+
+SCENARIO("Binary G-code decoder", "[BinaryGCode]")
+{
+  GIVEN("An ASCII G-code file")
+  {
+    BinaryGCode decoder;
+    const std::string file = "G28\nG1 X10 Y20\n";
+
+    THEN("All characters are passed through")
+    {
+      const auto result = decode(decoder, std::vector<uint8_t>(file.begin(), file.end()));
+      REQUIRE(!result.error);
+      REQUIRE(result.commands.empty());
+      REQUIRE(result.text == file);
+    }
+  }
+
+  GIVEN("A binary file with moves")
+  {
+    BinaryGCode decoder;
+    Encoder encoder;
+    std::vector<uint8_t> file = MAGIC;
+    const std::vector<std::vector<Param>> moves = {
+      {{'F', "1800"}, {'Z', "0.2"}},
+      {{'E', "0.12345"}, {'X', "10.5"}, {'Y', "20.25"}},
+      {{'E', "-0.8"}, {'X', "-3.001"}, {'Y', "199.999"}},
+      {{'E', "1234.56789"}, {'F', "2400.5"}, {'X', "0.001"}},
+    };
+    for(auto &move: moves) encoder.command(file, 0x81, move); // G1
+
+    const auto result = decode(decoder, file);
+
+    THEN("Each move is decoded with the values of strtof")
+    {
+      REQUIRE(!result.error);
+      REQUIRE(result.text.empty());
+      REQUIRE(result.commands.size() == moves.size());
+      for(size_t i = 0; i < moves.size(); ++i) {
+        const auto &command = result.commands[i];
+        REQUIRE(uint8_t(command[0]) == BinaryGCode::COMMAND);
+        REQUIRE(BinaryGCode::letter(command.data()) == 'G');
+        REQUIRE(BinaryGCode::codenum(command.data()) == 1);
+        for(auto &p: moves[i]) {
+          float v = 0;
+          REQUIRE(value(command, p.letter, v));
+          REQUIRE(v == std::strtof(p.text, nullptr));
+        }
+        float s = 0;
+        REQUIRE(!value(command, 'S', s));
+      }
+    }
+
+    THEN("Skipped commands keep the delta-coded values without converting them")
+    {
+      BinaryGCode skipping;
+      char buffer[96];
+      size_t commands = 0;
+      size_t i = 0;
+      for(; i < file.size() && commands < 2; ++i)
+        if(skipping.feed(file[i], buffer, sizeof(buffer), true) == BinaryGCode::BGC_COMMAND) ++commands;
+      const auto result2 = decode(skipping, std::vector<uint8_t>(file.begin() + i, file.end()));
+      REQUIRE(!result2.error);
+      REQUIRE(result2.commands.size() == 2);
+      float x = 0, e = 0;
+      REQUIRE(value(result2.commands[0], 'X', x));
+      REQUIRE(value(result2.commands[0], 'E', e));
+      REQUIRE(x == std::strtof("-3.001", nullptr));
+      REQUIRE(e == std::strtof("-0.8", nullptr));
+    }
+  }
+
+  GIVEN("A binary file with absolute E values beyond 2^24 in fixed point")
+  {
+    BinaryGCode decoder;
+    Encoder encoder;
+    std::vector<uint8_t> file = MAGIC;
+    const char *values[] = {"167.77217", "250.12345", "1234.56789", "9876.54321", "21000.00001"};
+    for(auto v: values) encoder.command(file, 0x81, {{'E', v}}); // G1
+
+    THEN("Each value is within 1 ulp of strtof")
+    {
+      const auto result = decode(decoder, file);
+      REQUIRE(!result.error);
+      REQUIRE(result.commands.size() == std::size(values));
+      for(size_t i = 0; i < std::size(values); ++i) {
+        float e = 0;
+        REQUIRE(value(result.commands[i], 'E', e));
+        const float expected = std::strtof(values[i], nullptr);
+        REQUIRE(e >= std::nextafter(expected, 0.0f));
+        REQUIRE(e <= std::nextafter(expected, 1e9f));
+      }
+    }
+  }
+
+  GIVEN("A binary file mixing records")
+  {
+    BinaryGCode decoder;
+    Encoder encoder;
+    std::vector<uint8_t> file = MAGIC;
+    encoder.command(file, 0x87, {{'X', nullptr}, {'Y', nullptr}});   // G28 X Y
+    const std::string text = "M117 Hello\n";
+    file.insert(file.end(), text.begin(), text.end());
+    encoder.other(file, 'M', 300, {{'P', "100"}, {'S', "440"}});
+
+    THEN("ASCII lines are passed through and commands are decoded")
+    {
+      const auto result = decode(decoder, file);
+      REQUIRE(!result.error);
+      REQUIRE(result.text == text);
+      REQUIRE(result.commands.size() == 2);
+      const char *g28 = result.commands[0].data();
+      REQUIRE(BinaryGCode::codenum(g28) == 28);
+      REQUIRE(BinaryGCode::codebits(g28) == ((1UL << ('X' - 'A')) | (1UL << ('Y' - 'A'))));
+      REQUIRE(BinaryGCode::valuebits(g28) == 0);
+      const char *m300 = result.commands[1].data();
+      REQUIRE(BinaryGCode::letter(m300) == 'M');
+      REQUIRE(BinaryGCode::codenum(m300) == 300);
+      float p = 0, s = 0;
+      REQUIRE(value(result.commands[1], 'P', p));
+      REQUIRE(value(result.commands[1], 'S', s));
+      REQUIRE(p == 100);
+      REQUIRE(s == 440);
+    }
+
+    THEN("A synchronization resets the delta-coded values")
+    {
+      Encoder encoder2;
+      std::vector<uint8_t> file2 = MAGIC;
+      encoder2.command(file2, 0x81, {{'X', "50"}});
+      file2.push_back(0xFF);
+      Encoder encoder3;
+      encoder3.command(file2, 0x81, {{'X', "7"}});
+      const auto result2 = decode(decoder, file2);
+      float x = 0;
+      REQUIRE(result2.commands.size() == 2);
+      REQUIRE(value(result2.commands[1], 'X', x));
+      REQUIRE(x == 7);
+    }
+
+    THEN("Decoding can restart after a synchronization, as when resuming after a power loss")
+    {
+      Encoder encoder2;
+      std::vector<uint8_t> file2 = MAGIC;
+      encoder2.command(file2, 0x81, {{'X', "50"}});
+      file2.push_back(0xFF);
+      const size_t sync = file2.size();
+      Encoder encoder3;
+      encoder3.command(file2, 0x81, {{'X', "7"}});
+      encoder3.command(file2, 0x81, {{'X', "9.5"}});
+
+      char buffer[96];
+      BinaryGCode::Result last = BinaryGCode::BGC_PASS;
+      for(size_t i = 0; i < sync; ++i) last = decoder.feed(file2[i], buffer, sizeof(buffer));
+      REQUIRE(last == BinaryGCode::BGC_SYNC);
+
+      BinaryGCode resumed;
+      resumed.resync();
+      const auto result2 = decode(resumed, std::vector<uint8_t>(file2.begin() + sync, file2.end()));
+      float x = 0;
+      REQUIRE(!result2.error);
+      REQUIRE(result2.commands.size() == 2);
+      REQUIRE(value(result2.commands[0], 'X', x));
+      REQUIRE(x == 7);
+      REQUIRE(value(result2.commands[1], 'X', x));
+      REQUIRE(x == 9.5f);
+    }
+
+    THEN("The first byte tells if a file is binary, a text file is read from any position")
+    {
+      REQUIRE(BinaryGCode::is_binary_file(MAGIC[0]));
+      REQUIRE(!BinaryGCode::is_binary_file('G'));
+      REQUIRE(!BinaryGCode::is_binary_file(';'));
+
+      BinaryGCode text;
+      text.set_text_file();
+      char buffer[96];
+      REQUIRE(text.feed(0xB9, buffer, sizeof(buffer)) == BinaryGCode::BGC_PASS);
+      REQUIRE(text.feed(0xFF, buffer, sizeof(buffer)) == BinaryGCode::BGC_PASS);
+    }
+  }
+
+  GIVEN("Invalid files")
+  {
+    THEN("A wrong magic is an error")
+    {
+      BinaryGCode decoder;
+      REQUIRE(decode(decoder, {0xB9, 'G', 'C', 'X', 0x01}).error);
+    }
+
+    THEN("An unknown common command is an error")
+    {
+      BinaryGCode decoder;
+      auto file = MAGIC;
+      file.push_back(0xBF);
+      REQUIRE(decode(decoder, file).error);
+    }
+
+    THEN("A varint longer than 32 bits is an error")
+    {
+      BinaryGCode decoder;
+      auto file = MAGIC;
+      file.insert(file.end(), {0xFE, 'G', 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01});
+      REQUIRE(decode(decoder, file).error);
+    }
+
+    THEN("Too many values for the buffer is an error")
+    {
+      BinaryGCode decoder;
+      auto file = MAGIC;
+      file.insert(file.end(), {0x81, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F});
+      file.insert(file.end(), 26, 0x00);
+      REQUIRE(decode(decoder, file).error);
+    }
+  }
+}
+
+TEST_CASE("Binary G-code benchmark", "[BinaryGCode][!benchmark]")
+{
+  Encoder encoder;
+  std::vector<uint8_t> file = MAGIC;
+  for(int i = 0; i < 100; ++i) encoder.command(file, 0x81, {{'E', "0.05123"}, {'X', "100.25"}, {'Y', "75.5"}});
+  char line[] = "G1 X100.25 Y75.5 E0.05123";
+
+  BENCHMARK("Decoder") {
+    BinaryGCode decoder;
+    return decode(decoder, file).commands.size();
+  };
+
+  BENCHMARK("strtof") {
+    float sum = 0;
+    for(int i = 0; i < 100; ++i)
+      for(const char *p: {line + 4, line + 12, line + 18}) sum += std::strtof(p, nullptr);
+    return sum;
+  };
+}
@@ -0,0 +1,210 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../lib/heatshrink.h"
+
+namespace {
+
+const size_t WINDOW = 1 << HEATSHRINK_STATIC_WINDOW_BITS;
+const size_t LOOKAHEAD = 1 << HEATSHRINK_STATIC_LOOKAHEAD_BITS;
+const size_t PACKET_SIZE = 96;    // MAX_CMD_SIZE, the packet buffer of BinaryStream
+const size_t PACKET_OVERHEAD = 10 + 6;  // Header, footer and "ok<sync>\n" (in the other direction)
+const size_t BLOCK_SIZE = 512;
+
+struct BitWriter {
+  std::vector<uint8_t> out;
+  size_t bits = 0;
+
+  void write(uint16_t value, uint8_t count) {
+    while(count--) {
+      if(bits % 8 == 0) out.push_back(0);
+      if(value >> count & 1) out.back() |= 0x80 >> (bits % 8);
+      ++bits;
+    }
+  }
+};
+
+// Greedy encoder with the format of heatshrink (as heatshrink2 on the host, not as compact)
+std::vector<uint8_t> encode(const std::string &data) {
+  BitWriter writer;
+  for(size_t i = 0; i < data.size();) {
+    size_t best_length = 0, best_offset = 0;
+    for(size_t offset = 1; offset <= WINDOW && offset <= i; ++offset) {
+      size_t length = 0;
+      while(length < LOOKAHEAD && i + length < data.size() && data[i + length] == data[i + length - offset]) ++length;
+      if(length > best_length) { best_length = length; best_offset = offset; }
+    }
+    if(best_length >= 2) {
+      writer.write(0, 1);
+      writer.write(best_offset - 1, HEATSHRINK_STATIC_WINDOW_BITS);
+      writer.write(best_length - 1, HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+      i += best_length;
+    }
+    else {
+      writer.write(1, 1);
+      writer.write(static_cast<uint8_t>(data[i++]), 8);
+    }
+  }
+  return writer.out;
+}
+
+// SDFileTransferProtocol::file_write and file_close of feature/binary_stream.h
+struct Transfer {
+  heatshrink_decoder hsd;
+  uint8_t decode_buffer[BLOCK_SIZE];
+  size_t data_waiting = 0;
+  std::string file;
+  size_t blocks = 0;
+
+  Transfer() { heatshrink_decoder_reset(&hsd); }
+
+  void write(const uint8_t *buffer, size_t length) {
+    size_t total_processed = 0, processed_count = 0;
+    HSD_poll_res presult;
+    while(total_processed < length) {
+      heatshrink_decoder_sink(&hsd, const_cast<uint8_t*>(&buffer[total_processed]), length - total_processed, &processed_count);
+      total_processed += processed_count;
+      do {
+        presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], BLOCK_SIZE - data_waiting, &processed_count);
+        data_waiting += processed_count;
+        if(data_waiting == BLOCK_SIZE) {
+          file.append(reinterpret_cast<char*>(decode_buffer), data_waiting);
+          ++blocks;
+          data_waiting = 0;
+        }
+      } while(presult == HSDR_POLL_MORE);
+    }
+  }
+
+  void close() {
+    file.append(reinterpret_cast<char*>(decode_buffer), data_waiting);
+    data_waiting = 0;
+    heatshrink_decoder_finish(&hsd);
+  }
+};
+
+std::string transfer(const std::vector<uint8_t> &compressed) {
+  Transfer transfer;
+  for(size_t i = 0; i < compressed.size(); i += PACKET_SIZE)
+    transfer.write(&compressed[i], std::min(PACKET_SIZE, compressed.size() - i));
+  transfer.close();
+  return transfer.file;
+}
+
+// Typical G-code of a curved model, as sliced
+std::string sliced_gcode(int lines) {
+  std::string gcode = ";LAYER:0\nM106 S255\nG1 F1500 E-6.5\n";
+  char line[64];
+  for(int i = 0; i < lines; ++i) {
+    snprintf(line, sizeof(line), "G1 X%.3f Y%.3f E%.5f\n", 100 + (i % 400) * 0.137, 80 + (i % 330) * 0.211, 0.01234 + i * 0.00071);
+    gcode += line;
+    if(i % 50 == 0) gcode += "G0 F7200 X110.5 Y95.2\n;TYPE:WALL-OUTER\n";
+  }
+  return gcode;
+}
+
+// M28: "N<line> " and "*<checksum>" around each line, "ok\n" for each line
+size_t ascii_wire_size(const std::string &gcode) {
+  size_t lines = 0;
+  for(const char c: gcode) if(c == '\n') ++lines;
+  return gcode.size() + lines * (8 + 3);
+}
+
+size_t binary_wire_size(size_t compressed_size) {
+  const size_t packets = (compressed_size + PACKET_SIZE - 1) / PACKET_SIZE;
+  return compressed_size + packets * PACKET_OVERHEAD;
+}
+
+// Upload rate in KB/s of the original file at a baud rate (10 bits per byte)
+double upload_rate(double baud, size_t size, size_t wire_size) {
+  return baud / 10 * size / wire_size / 1000;
+}
+
+}
+
+SCENARIO("Binary file transfer with heatshrink compression", "[heatshrink]")
+{
+  GIVEN("G-code of a curved model")
+  {
+    const std::string gcode = sliced_gcode(5000);
+    const std::vector<uint8_t> compressed = encode(gcode);
+
+    THEN("It is written exactly, with full blocks of 512 bytes")
+    {
+      Transfer transfer;
+      for(size_t i = 0; i < compressed.size(); i += PACKET_SIZE)
+        transfer.write(&compressed[i], std::min(PACKET_SIZE, compressed.size() - i));
+      REQUIRE(transfer.blocks == gcode.size() / BLOCK_SIZE);
+      transfer.close();
+      REQUIRE(transfer.file == gcode);
+    }
+
+    THEN("It is written exactly whatever the packet boundaries")
+    {
+      for(size_t size: { size_t(1), size_t(7), size_t(32), size_t(33), PACKET_SIZE }) {
+        Transfer transfer;
+        for(size_t i = 0; i < compressed.size(); i += size)
+          transfer.write(&compressed[i], std::min(size, compressed.size() - i));
+        transfer.close();
+        REQUIRE(transfer.file == gcode);
+      }
+    }
+
+    THEN("It is uploaded at least 2 times faster than with M28 and ASCII lines")
+    {
+      REQUIRE(upload_rate(115200, gcode.size(), binary_wire_size(compressed.size())) >=
+              2 * upload_rate(115200, gcode.size(), ascii_wire_size(gcode)));
+    }
+  }
+
+  GIVEN("Data without repetitions")
+  {
+    std::string data;
+    for(int i = 0; i < 3000; ++i) data += static_cast<char>((i * 7919) >> 3);
+
+    THEN("It is written exactly")
+    {
+      REQUIRE(transfer(encode(data)) == data);
+    }
+  }
+}
+
+TEST_CASE("Heatshrink decoder benchmark", "[heatshrink][!benchmark]")
+{
+  const std::string gcode = sliced_gcode(2000); // About 64 KB
+  const std::vector<uint8_t> compressed = encode(gcode);
+
+  for(const double baud: { 115200, 250000, 500000 })
+    std::printf("%6.0f baud: M28 %5.1f KB/s, binary %5.1f KB/s (compression %.2f)\n", baud,
+                upload_rate(baud, gcode.size(), ascii_wire_size(gcode)),
+                upload_rate(baud, gcode.size(), binary_wire_size(compressed.size())),
+                double(gcode.size()) / compressed.size());
+
+  BENCHMARK("Decode 64 KB in packets of 96 bytes") {
+    return transfer(compressed).size();
+  };
+}
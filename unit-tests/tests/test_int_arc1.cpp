@@ -0,0 +1,110 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cmath>
+#include "../lib/int_arc.h"
+
+SCENARIO("Integer arc rotation", "[IntArc]")
+{
+  GIVEN("A 100 mm radius arc with 0.5° segments")
+  {
+    const double radius = 100, start = 0.3, theta = 0.5 * M_PI / 180;
+    IntArc arc;
+    arc.start(radius * std::cos(start), radius * std::sin(start), theta);
+
+    THEN("The positions are within 1 µm of the exact ones after 25 segments")
+    {
+      for(int i = 1; i <= 25; ++i) {
+        arc.next();
+        const double a = radius * std::cos(start + i * theta), b = radius * std::sin(start + i * theta);
+        REQUIRE(std::fabs(arc.a() - a) < 0.001);
+        REQUIRE(std::fabs(arc.b() - b) < 0.001);
+      }
+    }
+
+    THEN("The radius stays within 10 µm after a full circle")
+    {
+      for(int i = 1; i <= 720; ++i) arc.next();
+      REQUIRE(std::fabs(std::hypot(arc.a(), arc.b()) - radius) < 0.01);
+    }
+  }
+
+  GIVEN("A clockwise arc")
+  {
+    IntArc arc;
+    arc.start(10, 0, -0.1);
+
+    THEN("It rotates clockwise")
+    {
+      arc.next();
+      REQUIRE(std::fabs(arc.a() - 10 * std::cos(0.1)) < 0.0001);
+      REQUIRE(std::fabs(arc.b() + 10 * std::sin(0.1)) < 0.0001);
+    }
+  }
+}
+
+SCENARIO("Arc segment length", "[IntArc]")
+{
+  GIVEN("A chordal tolerance of 0.01 mm and a minimum segment time of 20 ms")
+  {
+    THEN("Slow arcs use the longest chord within the tolerance")
+    {
+      const float mm = int_arc_segment_mm(10, 10, 0.01f, 20000, 0.1f, 2.0f);
+      REQUIRE(std::fabs(mm - std::sqrt(0.8f)) < 0.0001f);
+      // Deviation of the chord
+      REQUIRE(10 * (1 - std::cos(std::asin(mm / 2 / 10))) <= 0.0101f);
+    }
+
+    THEN("Fast arcs use segments that last at least the minimum segment time")
+    {
+      REQUIRE(std::fabs(int_arc_segment_mm(2, 60, 0.01f, 20000, 0.1f, 2.0f) - 1.2f) < 0.0001f);
+    }
+
+    THEN("The length is bounded")
+    {
+      REQUIRE(int_arc_segment_mm(0.01f, 1, 0.01f, 20000, 0.1f, 2.0f) == 0.1f);
+      REQUIRE(int_arc_segment_mm(1000, 1, 0.01f, 20000, 0.1f, 2.0f) == 2.0f);
+    }
+  }
+}
+
+TEST_CASE("Arc rotation benchmark", "[IntArc][!benchmark]")
+{
+  BENCHMARK("Integer") {
+    IntArc arc;
+    arc.start(50, 0, 0.01f);
+    for(int i = 0; i < 100; ++i) arc.next();
+    return arc.a();
+  };
+
+  BENCHMARK("Float") {
+    const float theta = 0.01f, sin_T = theta - theta * theta * theta / 6, cos_T = 1 - 0.5f * theta * theta;
+    float a = 50, b = 0;
+    for(int i = 0; i < 100; ++i) {
+      const float new_b = a * sin_T + b * cos_T;
+      a = a * cos_T - b * sin_T;
+      b = new_b;
+    }
+    return a;
+  };
+}
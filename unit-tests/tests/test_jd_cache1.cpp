@@ -0,0 +1,94 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include "../lib/jd_cache.h"
+
+namespace {
+
+using Cache = JunctionDeviationCache<16, true>;
+
+float exact_speed(float cos_theta) {
+  const float sin_theta_d2 = std::sqrt(0.5f * (1.0f - cos_theta));
+  return sin_theta_d2 / (1.0f - sin_theta_d2);
+}
+
+// Cosine of the junction for a direction change of the given angle (Planner uses -prev . next)
+float junction_cos(float degrees) { return -std::cos(degrees * float(M_PI) / 180.0f); }
+
+}
+
+SCENARIO("Junction deviation cache", "[JDCache]")
+{
+  GIVEN("Junction angles from 0.5° to 179.5°")
+  {
+    Cache cache;
+
+    THEN("The cached factors are never faster than the exact ones")
+    {
+      for(float angle = 0.5f; angle < 180; angle += 0.25f) {
+        const float c = junction_cos(angle);
+        const auto &factors = cache.get(c);
+        REQUIRE(factors.speed <= exact_speed(c));
+        REQUIRE(factors.theta >= std::acos(-c));
+      }
+    }
+
+    THEN("The junction speed is within 2% of the exact one")
+    {
+      for(float angle = 0.5f; angle < 180; angle += 0.25f) {
+        const float c = junction_cos(angle);
+        // The speed is the square root of the factor
+        REQUIRE(std::sqrt(cache.get(c).speed) >= 0.98f * std::sqrt(exact_speed(c)));
+      }
+    }
+  }
+
+  GIVEN("A cache")
+  {
+    Cache cache;
+
+    THEN("The result does not depend on the content of the cache")
+    {
+      const float c = junction_cos(37.0f);
+      const float first = cache.get(c).speed;
+      for(float angle = 1; angle < 180; angle += 1) cache.get(junction_cos(angle));
+      REQUIRE(cache.get(c).speed == first);
+    }
+
+    THEN("Repetitive geometry is served from the cache")
+    {
+      // Perimeters of a polygon and a zig-zag infill
+      for(int i = 0; i < 1000; ++i) {
+        cache.get(junction_cos(360.0f / 8));
+        cache.get(junction_cos(90.0f));
+        cache.get(junction_cos(180.0f - 0.1f));
+      }
+      REQUIRE(cache.misses <= 3);
+      REQUIRE(cache.hits >= 2997);
+
+      cache.reset_stats();
+      REQUIRE(cache.hits == 0);
+      REQUIRE(cache.misses == 0);
+    }
+  }
+}
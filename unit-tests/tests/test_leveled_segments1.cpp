@@ -0,0 +1,165 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "../lib/bilinear.h"
+
+namespace {
+
+constexpr float TOLERANCE = 0.005f;   // LEVELED_SEGMENT_TOLERANCE
+constexpr float SEGMENT_LENGTH = 5.0f; // LEVELED_SEGMENT_LENGTH
+
+struct Point { float x, y; };
+
+// 3x3 mesh on the bed of the Wanhao i3 Plus, not extrapolated beyond the grid
+struct Mesh {
+  static constexpr int POINTS = 3;
+  float z[POINTS][POINTS];
+  Point start{30, 30}, spacing{70, 70};
+
+  // Exact bilinear correction (the height of the edges is kept beyond the grid)
+  float correction(const Point &p) const {
+    const float cx = std::clamp((p.x - start.x) / spacing.x, 0.0f, float(POINTS - 1)),
+                cy = std::clamp((p.y - start.y) / spacing.y, 0.0f, float(POINTS - 1));
+    const int x = std::min(int(cx), POINTS - 2), y = std::min(int(cy), POINTS - 2);
+    const float u = cx - x, v = cy - y;
+    return z[x][y] * (1 - u) * (1 - v) + z[x + 1][y] * u * (1 - v) + z[x][y + 1] * (1 - u) * v + z[x + 1][y + 1] * u * v;
+  }
+
+  // Fractions of the move where the segments end, as LevelingBilinear::line_to_destination of
+  // feature/bedlevel/abl/bbl.cpp (ADAPTIVE_LEVELED_SEGMENTS) splits it
+  std::vector<float> split(const Point &a, const Point &b) const {
+    const Point diff{b.x - a.x, b.y - a.y};
+    const auto cell = [](float v, float s, float d) { return std::clamp(int(std::floor((v - s) / d)), -1, POINTS - 1); };
+    int c1x = cell(a.x, start.x, spacing.x), c1y = cell(a.y, start.y, spacing.y);
+    const int c2x = cell(b.x, start.x, spacing.x), c2y = cell(b.y, start.y, spacing.y);
+    const float cells_xy = std::fabs(diff.x / spacing.x * diff.y / spacing.y);
+    const auto exit = [](int c1, int c2, float s, float d, float a, float diff) {
+      return c1 == c2 ? 1.0f : (s + d * (c1 + (c2 > c1)) - a) / diff;
+    };
+
+    std::vector<float> ends;
+    for(float t1 = 0;;) {
+      const float tx = exit(c1x, c2x, start.x, spacing.x, a.x, diff.x), ty = exit(c1y, c2y, start.y, spacing.y, a.y, diff.y),
+                  t2 = std::max(t1, std::min(tx, ty)), dt = t2 - t1;
+      const bool in_grid = c1x >= 0 && c1x <= POINTS - 2 && c1y >= 0 && c1y <= POINTS - 2;
+      const float twist = !in_grid ? 0.0f : z[c1x][c1y] - z[c1x + 1][c1y] - z[c1x][c1y + 1] + z[c1x + 1][c1y + 1];
+      const uint16_t segments = leveled_segments(twist, cells_xy, dt, TOLERANCE);
+      for(uint16_t i = 1; i < segments; ++i) ends.push_back(t1 + dt * i / segments);
+      if(t2 >= 1.0f) break;
+      ends.push_back(t2);
+      if(tx <= ty) c1x += c2x > c1x ? 1 : -1;
+      if(ty <= tx) c1y += c2y > c1y ? 1 : -1;
+      t1 = t2;
+    }
+    ends.push_back(1.0f);
+    return ends;
+  }
+
+  // Largest distance between the segments and the leveled surface
+  float max_error(const Point &a, const Point &b, const std::vector<float> &ends) const {
+    const auto at = [&](float t) { return Point{a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t}; };
+    float error = 0, t1 = 0;
+    for(float t2: ends) {
+      const float z1 = correction(at(t1)), z2 = correction(at(t2));
+      for(int i = 1; i < 32; ++i) {
+        const float s = i / 32.0f;
+        error = std::max(error, std::fabs(correction(at(t1 + (t2 - t1) * s)) - (z1 + (z2 - z1) * s)));
+      }
+      t1 = t2;
+    }
+    return error;
+  }
+};
+
+// Segments of SEGMENT_LEVELED_MOVES (segmented_line_to_destination of module/motion.cpp)
+size_t fixed_segments(const Point &a, const Point &b) {
+  return std::max<size_t>(1, size_t(std::hypot(b.x - a.x, b.y - a.y) / SEGMENT_LENGTH));
+}
+
+}
+
+SCENARIO("Adaptive leveled segments", "[bilinear]")
+{
+  GIVEN("A move across a single twisted cell")
+  {
+    THEN("The number of segments is the smallest keeping the distance to the surface within the tolerance")
+    {
+      Mesh mesh{{{0, 0, 0}, {0, 0.4f, 0}, {0, 0, 0}}};
+      for(float twist: {0.02f, 0.1f, 0.4f, 1.0f, -0.7f}) {
+        mesh.z[1][1] = twist;
+        const Point a{31, 31}, b{99, 99};
+        const auto ends = mesh.split(a, b);
+        const uint16_t n = leveled_segments(twist, 68.0f * 68 / (70 * 70), 1.0f, TOLERANCE);
+        REQUIRE(ends.size() == n);
+        REQUIRE(mesh.max_error(a, b, ends) <= TOLERANCE);
+        if(n > 1) {
+          std::vector<float> fewer;
+          for(uint16_t i = 1; i < n; ++i) fewer.push_back(float(i) / (n - 1));
+          REQUIRE(mesh.max_error(a, b, fewer) > TOLERANCE);
+        }
+      }
+    }
+
+    THEN("A flat or tilted cell, or a move along an axis, is not split")
+    {
+      REQUIRE(leveled_segments(0.0f, 1.0f, 1.0f, TOLERANCE) == 1);
+      REQUIRE(leveled_segments(0.5f, 0.0f, 1.0f, TOLERANCE) == 1);
+      REQUIRE(leveled_segments(0.02f, 1.0f, 1.0f, TOLERANCE) == 1); // Deviation of exactly the tolerance
+    }
+  }
+
+  GIVEN("Random moves over a 3x3 mesh with +/-0.3 mm of noise")
+  {
+    std::mt19937 random{1234};
+    std::uniform_real_distribution<float> noise{-0.3f, 0.3f}, bed{0.0f, 200.0f};
+
+    size_t adaptive = 0, fixed = 0;
+    float error = 0;
+    for(int m = 0; m < 100; ++m) {
+      Mesh mesh{};
+      for(auto &column: mesh.z) for(auto &z: column) z = noise(random);
+      for(int i = 0; i < 100; ++i) {
+        const Point a{bed(random), bed(random)}, b{bed(random), bed(random)};
+        const auto ends = mesh.split(a, b);
+        adaptive += ends.size();
+        fixed += fixed_segments(a, b);
+        error = std::max(error, mesh.max_error(a, b, ends));
+      }
+    }
+
+    THEN("The Z error stays within the tolerance")
+    {
+      REQUIRE(error <= TOLERANCE * 1.001f);
+    }
+
+    THEN("There are about 4.6 times fewer segments than with 5 mm segments")
+    {
+      UNSCOPED_INFO("Adaptive: " << adaptive << " segments, fixed: " << fixed << " segments");
+      REQUIRE(float(fixed) / adaptive >= 4.5f);
+    }
+  }
+}
@@ -0,0 +1,159 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../lib/meatpack_lut.h"
+
+namespace {
+
+// meatPackLookupTable of feature/meatpack.cpp
+const uint8_t nibbles[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '.', ' ', '\n', 'G', 'X', '\0' };
+
+// MeatPack::unpack_chars without MEATPACK_LOOKUP_TABLE
+uint8_t unpack_nibbles(const uint8_t pk, uint8_t *out) {
+  uint8_t flags = 0;
+  if((pk & 0x0F) == 0x0F) flags = meatpack_lut::FIRST_IS_LITERAL; else out[0] = nibbles[pk & 0x0F];
+  if((pk & 0xF0) == 0xF0) flags |= meatpack_lut::SECOND_IS_LITERAL; else out[1] = nibbles[pk >> 4];
+  return flags;
+}
+
+int index_of(char c) {
+  for(int i = 0; i < 15; ++i) if(nibbles[i] == c) return i;
+  return 15;
+}
+
+// Packing as done by the host (OctoPrint-MeatPack)
+std::vector<uint8_t> pack(const std::string &gcode) {
+  std::vector<uint8_t> packed;
+  for(size_t i = 0; i < gcode.size();) {
+    const char c1 = gcode[i++];
+    // After a newline, the second character of the byte is not used
+    const char c2 = (c1 != '\n' && i < gcode.size()) ? gcode[i++] : '\n';
+    const int i1 = index_of(c1), i2 = c1 == '\n' ? 0 : index_of(c2);
+    packed.push_back(uint8_t(i2 << 4 | i1));
+    if(i1 == 15) packed.push_back(c1);
+    if(i2 == 15) packed.push_back(c2);
+  }
+  return packed;
+}
+
+// MeatPack::handle_rx_char_inner, packing active, with a given unpack function
+template<typename Unpack>
+std::string unpack(const std::vector<uint8_t> &packed, Unpack unpack_chars) {
+  std::string out;
+  uint8_t full_char_count = 0, second_char = 0;
+  for(const uint8_t c: packed) {
+    if(!full_char_count) {
+      uint8_t buf[2] = { 0, 0 };
+      const uint8_t res = unpack_chars(c, buf);
+      if(res & meatpack_lut::FIRST_IS_LITERAL) {
+        ++full_char_count;
+        if(res & meatpack_lut::SECOND_IS_LITERAL) ++full_char_count;
+        else second_char = buf[1];
+      }
+      else {
+        out += char(buf[0]);
+        if(buf[0] != '\n') {
+          if(res & meatpack_lut::SECOND_IS_LITERAL) ++full_char_count;
+          else out += char(buf[1]);
+        }
+      }
+    }
+    else {
+      out += char(c);
+      if(second_char) { out += char(second_char); second_char = 0; }
+      --full_char_count;
+    }
+  }
+  return out;
+}
+
+// Typical G-code of a curved model
+std::string curved_gcode(int lines) {
+  std::string gcode;
+  char line[64];
+  for(int i = 0; i < lines; ++i) {
+    snprintf(line, sizeof(line), "G1 X%.3f Y%.3f E%.5f\n", 100 + (i % 400) * 0.137, 80 + (i % 330) * 0.211, 0.01234 + i * 0.00071);
+    gcode += line;
+  }
+  return gcode;
+}
+
+}
+
+SCENARIO("MeatPack lookup table decoder", "[MeatPack]")
+{
+  GIVEN("All the packed bytes")
+  {
+    THEN("The table gives the same characters as the nibble decoder")
+    {
+      for(int pk = 0; pk < 256; ++pk) {
+        uint8_t a[2] = { 0, 0 }, b[2] = { 0, 0 };
+        const uint8_t fa = meatpack_lut::unpack(uint8_t(pk), a, false), fb = unpack_nibbles(uint8_t(pk), b);
+        REQUIRE(fa == fb);
+        if(!(fa & meatpack_lut::FIRST_IS_LITERAL)) REQUIRE(a[0] == b[0]);
+        if(!(fa & meatpack_lut::SECOND_IS_LITERAL)) REQUIRE(a[1] == b[1]);
+      }
+    }
+
+    THEN("Spaces are replaced by E in no-spaces mode")
+    {
+      uint8_t out[2];
+      REQUIRE(meatpack_lut::unpack(0xBB, out, true) == 0);
+      REQUIRE(out[0] == 'E');
+      REQUIRE(out[1] == 'E');
+    }
+  }
+
+  GIVEN("G-code of a curved model")
+  {
+    const std::string gcode = curved_gcode(1000) + "M104 S210 ; comment\nM117 Hello\n";
+    const std::vector<uint8_t> packed = pack(gcode);
+
+    THEN("It is decoded exactly")
+    {
+      REQUIRE(unpack(packed, [](uint8_t pk, uint8_t *out) { return meatpack_lut::unpack(pk, out, false); }) == gcode);
+    }
+
+    THEN("At a given baud rate, at least 1.6 times more lines are streamed")
+    {
+      const std::string moves = curved_gcode(1000);
+      REQUIRE(double(moves.size()) / pack(moves).size() >= 1.6);
+    }
+  }
+}
+
+TEST_CASE("MeatPack decoder benchmark", "[MeatPack][!benchmark]")
+{
+  const std::vector<uint8_t> packed = pack(curved_gcode(200));
+
+  BENCHMARK("Lookup table") {
+    return unpack(packed, [](uint8_t pk, uint8_t *out) { return meatpack_lut::unpack(pk, out, false); }).size();
+  };
+
+  BENCHMARK("Nibbles") {
+    return unpack(packed, unpack_nibbles).size();
+  };
+}
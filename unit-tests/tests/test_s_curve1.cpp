@@ -0,0 +1,127 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cmath>
+#include "../lib/s_curve.h"
+
+namespace {
+
+// Exact normalized profile
+double s_exact(double t) { return t * t * t * (10 + t * (-15 + 6 * t)); }
+
+// Stepper::_calc_bezier_curve_coeffs and _eval_bezier_curve with S_CURVE_TABLE
+uint32_t eval_table(uint32_t v0, uint32_t v1, uint32_t av, uint32_t curr_step) {
+  if(!curr_step) return v0;
+  const bool negative = v1 < v0;
+  return s_curve_speed(v0, negative ? v0 - v1 : v1 - v0, negative, av, curr_step);
+}
+
+// Generic (non ARM) Bézier evaluation of Stepper::_eval_bezier_curve, used as a reference
+uint32_t eval_bezier(uint32_t v0, uint32_t v1, uint32_t av32, uint32_t curr_step) {
+  const int32_t A = 768 * (int32_t(v1) - int32_t(v0)), B = 1920 * (int32_t(v0) - int32_t(v1)),
+                C = 1280 * (int32_t(v1) - int32_t(v0)), F = 128 * v0;
+  uint32_t t = av32 * curr_step;
+  uint64_t f = t;
+  f *= t; f >>= 32;
+  f *= t; f >>= 32;
+  int64_t acc = (int64_t) F << 31;
+  acc += ((uint32_t) f >> 1) * (int64_t) C;
+  f *= t; f >>= 32;
+  acc += ((uint32_t) f >> 1) * (int64_t) B;
+  f *= t; f >>= 32;
+  acc += ((uint32_t) f >> 1) * (int64_t) A;
+  acc >>= (31 + 7);
+  return (uint32_t) acc;
+}
+
+}
+
+SCENARIO("S-curve lookup table", "[SCurve]")
+{
+  GIVEN("The normalized S-curve table")
+  {
+    THEN("It starts at 0 and ends at 1")
+    {
+      REQUIRE(s_curve_interpolate(0) == 0);
+      REQUIRE(s_curve_interpolate(0xFFFF) >= 0xFFFF - 2);
+    }
+
+    THEN("It is monotonic")
+    {
+      uint16_t previous = 0;
+      for(uint32_t t = 0; t <= 0xFFFF; ++t) {
+        const uint16_t s = s_curve_interpolate(uint16_t(t));
+        REQUIRE(s >= previous);
+        previous = s;
+      }
+    }
+
+    THEN("It is close to the exact curve")
+    {
+      for(uint32_t t = 0; t <= 0xFFFF; ++t) {
+        const double exact = s_exact(t / 65536.0) * 65536.0;
+        REQUIRE(std::fabs(s_curve_interpolate(uint16_t(t)) - exact) <= 16); // 0.025%
+      }
+    }
+  }
+
+  GIVEN("An acceleration from 1000 to 9000 steps/s in 50000 ticks")
+  {
+    const uint32_t v0 = 1000, v1 = 9000, ts = 50000;
+    const uint32_t av = uint32_t((1ULL << S_CURVE_AV_BITS) / ts);
+
+    THEN("The speeds are within 0.25% of the Bézier curve")
+    {
+      for(uint32_t step = 0; step < ts; step += 7) {
+        const double exact = v0 + (v1 - v0) * s_exact(double(step) / ts);
+        REQUIRE(std::fabs(eval_table(v0, v1, av, step) - exact) <= (v1 - v0) / 400.0);
+      }
+    }
+
+    THEN("A deceleration is symmetric")
+    {
+      for(uint32_t step = 0; step < ts; step += 7) {
+        const uint32_t up = eval_table(v0, v1, av, step), down = eval_table(v1, v0, av, step);
+        REQUIRE(std::abs(int32_t(up - v0) - int32_t(v1 - down)) <= 1);
+      }
+    }
+  }
+}
+
+TEST_CASE("S-curve evaluation benchmark", "[SCurve][!benchmark]")
+{
+  const uint32_t v0 = 1000, v1 = 9000, ts = 50000;
+  const uint32_t av = uint32_t((1ULL << S_CURVE_AV_BITS) / ts), av32 = uint32_t((1ULL << 32) / ts);
+
+  BENCHMARK("Table") {
+    uint32_t sum = 0;
+    for(uint32_t step = 1; step < ts; step += 50) sum += eval_table(v0, v1, av, step);
+    return sum;
+  };
+
+  BENCHMARK("Bézier") {
+    uint32_t sum = 0;
+    for(uint32_t step = 1; step < ts; step += 50) sum += eval_bezier(v0, v1, av32, step);
+    return sum;
+  };
+}
@@ -0,0 +1,154 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include "../lib/strtonum.h"
+
+namespace {
+
+// Random G-code number: [-+]?[0-9]{0,int_digits}(.[0-9]{0,decimals})?
+std::string random_number(std::mt19937 &rng, int int_digits, int decimals) {
+  std::string s;
+  switch(rng() % 4) { case 0: s += '-'; break; case 1: s += '+'; break; default: break; }
+  const int n = int(rng() % (int_digits + 1));
+  for(int i = 0; i < n; ++i) s += char('0' + rng() % 10);
+  if(decimals > 0 && rng() % 2) {
+    s += '.';
+    const int d = 1 + int(rng() % decimals);
+    for(int i = 0; i < d; ++i) s += char('0' + rng() % 10);
+  }
+  if(s.empty() || !std::isdigit(s.back())) s += char('0' + rng() % 10);
+  return s;
+}
+
+int significant_digits(const std::string &s) {
+  int n = 0;
+  bool started = false;
+  for(char c: s) {
+    if(!std::isdigit(c)) continue;
+    if(c != '0') started = true;
+    if(started) ++n;
+  }
+  // Trailing zeros of decimals do not count
+  const auto dot = s.find('.');
+  if(dot != std::string::npos)
+    for(size_t i = s.size() - 1; i > dot && s[i] == '0' && n > 0; --i) --n;
+  return n;
+}
+
+int32_t ulps(float a, float b) {
+  int32_t ia, ib;
+  std::memcpy(&ia, &a, sizeof(a));
+  std::memcpy(&ib, &b, sizeof(b));
+  if((ia < 0) != (ib < 0)) return a == b ? 0 : INT32_MAX;
+  return std::abs(ia - ib);
+}
+
+}
+
+SCENARIO("Fast number parser", "[StrToNum]")
+{
+  GIVEN("Typical G-code values")
+  {
+    THEN("They are identical to strtof")
+    {
+      for(const char *s: {"0", "-0", "1", "10.5", "-3.001", "+7", ".5", "-.25", "5.", "0.2", "1800", "2400.0",
+                          "199.999", "0.12345", "-0.8", "12345.67", "0.0001", "255", "3.14159", "0.00001"})
+        REQUIRE(fast_strtof(s) == std::strtof(s, nullptr));
+    }
+
+    THEN("Parsing stops at the first other character")
+    {
+      REQUIRE(fast_strtof("12.5Y3") == 12.5f);
+      REQUIRE(fast_strtof("1E5") == 1.0f);
+      REQUIRE(fast_strtof("0x10") == 0.0f);
+      REQUIRE(fast_strtof("2.5 E3") == 2.5f);
+      REQUIRE(fast_strtof("7*42") == 7.0f);
+    }
+
+    THEN("Integers are identical to strtol")
+    {
+      for(const char *s: {"0", "-1", "+42", "123456", "2147483647", "-2147483647", "12.7", "-3.9", " 5", "110*37"})
+        REQUIRE(fast_strtol(s) == std::strtol(s, nullptr, 10));
+    }
+  }
+
+  GIVEN("Random numbers with up to 7 significant digits and 5 decimals")
+  {
+    std::mt19937 rng(1234);
+
+    THEN("They are identical to strtof")
+    {
+      for(int i = 0; i < 200000; ++i) {
+        const std::string s = random_number(rng, 5, 5);
+        if(significant_digits(s) > 7) continue;
+        INFO(s);
+        REQUIRE(fast_strtof(s.c_str()) == std::strtof(s.c_str(), nullptr));
+      }
+    }
+  }
+
+  GIVEN("Random numbers with up to 15 digits and 10 decimals")
+  {
+    std::mt19937 rng(5678);
+
+    THEN("They are within 1 ulp of strtof")
+    {
+      for(int i = 0; i < 200000; ++i) {
+        const std::string s = random_number(rng, 15, 10);
+        INFO(s);
+        REQUIRE(ulps(fast_strtof(s.c_str()), std::strtof(s.c_str(), nullptr)) <= 1);
+      }
+    }
+
+    THEN("Integers are identical to strtol")
+    {
+      for(int i = 0; i < 200000; ++i) {
+        const std::string s = random_number(rng, 9, 0);
+        INFO(s);
+        REQUIRE(fast_strtol(s.c_str()) == std::strtol(s.c_str(), nullptr, 10));
+      }
+    }
+  }
+}
+
+TEST_CASE("Fast number parser benchmark", "[StrToNum][!benchmark]")
+{
+  const char *values[] = {"123.456", "-12.5", "0.04567", "1800", "87.125"};
+
+  BENCHMARK("fast_strtof") {
+    float sum = 0;
+    for(auto v: values) sum += fast_strtof(v);
+    return sum;
+  };
+
+  BENCHMARK("strtof") {
+    float sum = 0;
+    for(auto v: values) sum += std::strtof(v, nullptr);
+    return sum;
+  };
+}
@@ -0,0 +1,194 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cmath>
+#include <vector>
+#include "../lib/temperature.h"
+
+namespace {
+
+constexpr ThermistorLUT lut = ThermistorLUT::make(temptable_1);
+constexpr size_t TABLE_LEN = sizeof(temptable_1) / sizeof(temptable_1[0]);
+
+// SCAN_THERMISTOR_TABLE of module/temperature.cpp
+float scan(const raw_adc_t raw) {
+  uint8_t l = 0, r = TABLE_LEN, m;
+  for(;;) {
+    m = (l + r) >> 1;
+    if(!m) return temptable_1[0].celsius;
+    if(m == l || m == r) return temptable_1[TABLE_LEN - 1].celsius;
+    const raw_adc_t v00 = temptable_1[m - 1].value, v10 = temptable_1[m].value;
+    if(raw < v00) r = m;
+    else if(raw > v10) l = m;
+    else {
+      const celsius_t v01 = temptable_1[m - 1].celsius, v11 = temptable_1[m].celsius;
+      return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);
+    }
+  }
+}
+
+// PID_t of module/temperature.h (floats)
+struct FloatPID {
+  bool pid_reset = true;
+  float temp_iState = 0, temp_dState = 0, work_d = 0;
+  float Kp, Ki, Kd;
+
+  FloatPID(float p, float i, float d): Kp(p), Ki(scalePID_i(i)), Kd(scalePID_d(d)) {}
+
+  float get_pid_output(const float target, const float current) {
+    const float pid_error = target - current;
+    if(!target || pid_error < -(PID_FUNCTIONAL_RANGE)) { pid_reset = true; return 0; }
+    else if(pid_error > PID_FUNCTIONAL_RANGE) { pid_reset = true; return 255; }
+    if(pid_reset) { pid_reset = false; temp_iState = 0; work_d = 0; }
+    const float max_power_over_i_gain = 255.0f / Ki;
+    temp_iState = constrain(temp_iState + pid_error, 0, max_power_over_i_gain);
+    const float work_p = Kp * pid_error, work_i = Ki * temp_iState;
+    work_d = work_d + PID_K2 * (Kd * (temp_dState - current) - work_d);
+    temp_dState = current;
+    return constrain(work_p + work_i + work_d, 0, 255);
+  }
+
+  float get_pid_output(const celsius_t target, const int16_t current) { return get_pid_output(float(target), current / 16.0f); }
+};
+
+// First order model of a heater, sampled at PID_dT, read in 1/16 °C as with THERMISTOR_LUT
+struct Heater {
+  float temperature = 20, ambient = 20, heating, loss;
+
+  Heater(float heating_per_s, float loss_per_s): heating(heating_per_s * PID_dT), loss(loss_per_s * PID_dT) {}
+
+  int16_t read() const { return int16_t(std::lround(temperature * 16)); }
+  void update(float power) { temperature += power / 255 * heating - (temperature - ambient) * loss; }
+};
+
+// Temperatures (in 1/16 °C) read while a heater is controlled by a PID
+template<typename PID>
+std::vector<int16_t> heat(PID &pid, celsius_t target, Heater heater, int cycles) {
+  std::vector<int16_t> readings;
+  for(int i = 0; i < cycles; ++i) {
+    readings.push_back(heater.read());
+    heater.update(pid.get_pid_output(target, readings.back()));
+  }
+  return readings;
+}
+
+}
+
+SCENARIO("Thermistor table evenly spaced by raw value", "[temperature]")
+{
+  GIVEN("The table of thermistor 1 resampled every 64 raw values")
+  {
+    THEN("It has an entry after the last raw value")
+    {
+      REQUIRE(ThermistorLUT::SIZE == 257);
+      REQUIRE((ThermistorLUT::SIZE - 1) << ThermistorLUT::SHIFT > MAX_RAW_THERMISTOR_VALUE);
+    }
+
+    THEN("Conversions are close to the interpolation of the original table")
+    {
+      float max_260 = 0, max_275 = 0;
+      for(raw_adc_t raw = 0; raw <= MAX_RAW_THERMISTOR_VALUE; ++raw) {
+        const float expected = scan(raw), error = std::fabs(lut.to_celsius(raw) - expected);
+        if(expected <= 260) max_260 = std::max(max_260, error);
+        if(expected <= 275) max_275 = std::max(max_275, error);
+      }
+      REQUIRE(max_260 <= 0.25f);
+      REQUIRE(max_275 <= 0.65f);
+    }
+
+    THEN("Values outside of the original table are clamped")
+    {
+      REQUIRE(lut.to_celsius(0) == temptable_1[0].celsius);
+      REQUIRE(lut.to_celsius(MAX_RAW_THERMISTOR_VALUE) == temptable_1[TABLE_LEN - 1].celsius);
+    }
+
+    THEN("Temperatures decrease when raw values increase")
+    {
+      for(raw_adc_t raw = 1; raw <= MAX_RAW_THERMISTOR_VALUE; ++raw)
+        REQUIRE(lut.convert(raw) <= lut.convert(raw - 1));
+    }
+  }
+}
+
+SCENARIO("PID computed with integers", "[temperature]")
+{
+  GIVEN("The hotend and bed PID of the Wanhao i3 Plus")
+  {
+    struct Case { float p, i, d; celsius_t target; Heater heater; };
+    const Case cases[] = {
+      { 24.87f, 1.50f, 102.90f, 200, Heater(4.0f, 0.012f) },
+      { 333.66f, 60.79f, 457.83f, 60, Heater(1.0f, 0.008f) },
+    };
+
+    THEN("The power is the one of the float PID, within 1/255, for the same readings")
+    {
+      for(const auto &c: cases) {
+        FloatPID reference(c.p, c.i, c.d);
+        const std::vector<int16_t> readings = heat(reference, c.target, c.heater, 20000);
+
+        FloatPID pid_float(c.p, c.i, c.d);
+        PIDFixed_t<0, 255> pid_fixed;
+        pid_fixed.set(c.p, c.i, c.d);
+        float max_error = 0;
+        for(const int16_t reading: readings)
+          max_error = std::max(max_error, std::fabs(pid_fixed.get_pid_output(c.target, reading) - pid_float.get_pid_output(c.target, reading)));
+        REQUIRE(max_error <= 1.0f);
+      }
+    }
+
+    THEN("The temperature is held at the target")
+    {
+      for(const auto &c: cases) {
+        PIDFixed_t<0, 255> pid;
+        pid.set(c.p, c.i, c.d);
+        const std::vector<int16_t> readings = heat(pid, c.target, c.heater, 20000);
+        for(size_t i = readings.size() - 1000; i < readings.size(); ++i)
+          REQUIRE(std::abs(readings[i] - c.target * 16) <= 8);
+      }
+    }
+
+    THEN("The gains are given back as set")
+    {
+      PIDFixed_t<0, 255> pid;
+      pid.set(24.87f, 1.50f, 102.90f);
+      REQUIRE(std::fabs(pid.p() - 24.87f) < 0.001f);
+      REQUIRE(std::fabs(pid.i() - 1.50f) < 0.001f);
+      REQUIRE(std::fabs(pid.d() - 102.90f) < 0.01f);
+    }
+  }
+}
+
+TEST_CASE("Thermistor conversion benchmark", "[temperature][!benchmark]")
+{
+  BENCHMARK("Table bisection and float interpolation") {
+    float sum = 0;
+    for(raw_adc_t raw = 0; raw < MAX_RAW_THERMISTOR_VALUE; raw += 7) sum += scan(raw);
+    return sum;
+  };
+
+  BENCHMARK("Evenly spaced table and integer interpolation") {
+    float sum = 0;
+    for(raw_adc_t raw = 0; raw < MAX_RAW_THERMISTOR_VALUE; raw += 7) sum += lut.to_celsius(raw);
+    return sum;
+  };
+}
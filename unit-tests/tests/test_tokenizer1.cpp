@@ -0,0 +1,325 @@
+/**
+ * ADVi3++ Unit Tests
+ *
+ * Copyright (C) 2024 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../parameters.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstring>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include "../lib/tokenizer.h"
+
+namespace {
+
+bool numeric(char c) { return c >= '0' && c <= '9'; }
+bool valid_signless(const char *p) { return numeric(p[0]) || (p[0] == '.' && numeric(p[1])); }
+bool valid_float(const char *p) { return valid_signless(p) || ((p[0] == '-' || p[0] == '+') && valid_signless(&p[1])); }
+bool decimal_signed(char c) { return numeric(c) || c == '.' || c == '-' || c == '+'; }
+
+// GCodeParser::parse with FASTER_GCODE_PARSER, without options
+struct Reference {
+  char *command_ptr = nullptr, *string_arg = nullptr;
+  char letter = '?';
+  uint16_t codenum = 0;
+  uint32_t codebits = 0;
+  char *values[26] = {};
+
+  explicit Reference(char *p) {
+    while(*p == ' ') ++p;
+    if(*p == 'N' && (numeric(p[1]) || p[1] == '-')) {
+      p += 2;
+      while(numeric(*p)) ++p;
+      while(*p == ' ') ++p;
+    }
+    command_ptr = p;
+    const char l = *p++;
+    char *starpos = strchr(p, '*');
+    if(starpos) {
+      --starpos;
+      while(*starpos == ' ') --starpos;
+      starpos[1] = '\0';
+    }
+    if(l != 'G' && l != 'M' && l != 'T') return;
+    while(*p == ' ') p++;
+    if(!numeric(*p)) return;
+    letter = l;
+    do { codenum = codenum * 10 + *p++ - '0'; } while(numeric(*p));
+    while(*p == ' ') p++;
+    if(letter == 'M') switch(codenum) {
+      case 23: case 28: case 30: case 117: case 118: case 928: string_arg = p; return;
+      default: break;
+    }
+    while(const char param = *p++) {
+      if(param == '!' && letter == 'M' && codenum == 32) { string_arg = p; return; }
+      if(param >= 'A' && param <= 'Z') {
+        while(*p == ' ') p++;
+        const bool has_val = valid_float(p);
+        if(!has_val && !string_arg) string_arg = p - 1;
+        codebits |= uint32_t(1) << (param - 'A');
+        values[param - 'A'] = has_val ? p : nullptr;
+      }
+      else if(!string_arg)
+        string_arg = p - 1;
+      if(!(*p >= 'A' && *p <= 'Z')) {
+        while(*p && decimal_signed(*p)) p++;
+        while(*p == ' ') p++;
+      }
+    }
+  }
+};
+
+GCodeTokenizer tokenize(const char *line) {
+  GCodeTokenizer tokenizer{};
+  for(const char *p = line; *p; ++p) tokenizer.feed(*p);
+  tokenizer.end(line, strlen(line));
+  return tokenizer;
+}
+
+// Compare the index with the reference parser, on a copy of the line
+void check(const std::string &line) {
+  const GCodeTokenizer tokenizer = tokenize(line.c_str());
+  const GCodeIndex &index = tokenizer.index();
+  if(!index.letter) return; // Parsed as usual
+
+  char copy[128];
+  strcpy(copy, line.c_str());
+  const Reference ref(copy);
+  INFO("Line: \"" << line << "\"");
+  REQUIRE(ref.letter == index.letter);
+  REQUIRE(ref.command_ptr == copy + index.command);
+  REQUIRE(ref.codenum == index.codenum);
+  REQUIRE(ref.codebits == index.codebits);
+  for(uint8_t i = 0; i < 26; ++i) {
+    if(!(ref.codebits & (uint32_t(1) << i))) continue;
+    // As GCodeParser::seen
+    char *value = index.param[i] ? copy + index.command + index.param[i] : nullptr;
+    if(value && !valid_float(value)) value = nullptr;
+    REQUIRE(ref.values[i] == value);
+  }
+  REQUIRE(ref.string_arg == (index.string_arg ? copy + index.command + index.string_arg : nullptr));
+
+  // Packed for the command queue
+  char packed[64];
+  const uint8_t size = index.pack(packed, sizeof(packed));
+  REQUIRE(GCodeIndex::packed_size(packed) == size);
+  GCodeIndex unpacked{};
+  unpacked.unpack(packed);
+  REQUIRE(unpacked.letter == index.letter);
+  REQUIRE(unpacked.command == index.command);
+  REQUIRE(unpacked.star == index.star);
+  REQUIRE(unpacked.string_arg == index.string_arg);
+  REQUIRE(unpacked.codenum == index.codenum);
+  REQUIRE(unpacked.subcode == index.subcode);
+  REQUIRE(unpacked.codebits == index.codebits);
+  for(uint8_t i = 0; i < 26; ++i)
+    if(index.codebits & (uint32_t(1) << i)) REQUIRE(unpacked.param[i] == index.param[i]);
+}
+
+uint8_t checksum(const std::string &s) {
+  uint8_t c = 0;
+  for(char ch: s) c ^= ch;
+  return c;
+}
+
+std::string with_checksum(const std::string &s) { return s + "*" + std::to_string(checksum(s)); }
+
+}
+
+SCENARIO("Single-pass G-code tokenizer", "[Tokenizer]")
+{
+  GIVEN("A line from a host, with a line number and a checksum")
+  {
+    const std::string line = with_checksum("N123 G1 X10.5 Y-2 E.3 F1500");
+
+    THEN("The line number, the checksum and the parameters are known")
+    {
+      const GCodeTokenizer tokenizer = tokenize(line.c_str());
+      REQUIRE(tokenizer.has_N());
+      REQUIRE(tokenizer.N() == 123);
+      REQUIRE(tokenizer.has_checksum());
+      REQUIRE(tokenizer.checksum_ok());
+      REQUIRE(tokenizer.is_command('G', 1));
+      const GCodeIndex &index = tokenizer.index();
+      REQUIRE(index.letter == 'G');
+      REQUIRE(index.command == 5);
+      REQUIRE(index.param['X' - 'A'] == 4);
+      REQUIRE(index.param['F' - 'A'] == 18);
+      REQUIRE(index.star == 22);
+      check(line);
+    }
+
+    THEN("A wrong checksum is detected")
+    {
+      std::string wrong = line;
+      wrong.back() = wrong.back() == '9' ? '0' : wrong.back() + 1;
+      REQUIRE(!tokenize(wrong.c_str()).checksum_ok());
+      REQUIRE(!tokenize((line + "x").c_str()).checksum_ok());
+      REQUIRE(!tokenize("N1 G28*").checksum_ok());
+    }
+
+    THEN("Leading spaces are not part of the checksum")
+    {
+      REQUIRE(tokenize(("  " + line).c_str()).checksum_ok());
+    }
+
+    THEN("The checksum is after the last '*'")
+    {
+      REQUIRE(tokenize(with_checksum("N7 M117 A*B").c_str()).checksum_ok());
+    }
+  }
+
+  GIVEN("Lines without number or checksum")
+  {
+    THEN("They are reported as such")
+    {
+      const GCodeTokenizer tokenizer = tokenize("G28 X Y");
+      REQUIRE(!tokenizer.has_N());
+      REQUIRE(!tokenizer.has_checksum());
+      REQUIRE(tokenizer.index().letter == 'G');
+      check("G28 X Y");
+      REQUIRE(tokenize("N-5 M110 N0").N() == -5);
+    }
+  }
+
+  GIVEN("Lines that are not indexed")
+  {
+    THEN("They are left to GCodeParser")
+    {
+      for(const char *line: {"M117 Hello", "M23 FILE.GCO", "G1 x10", "M32 !/path#", "S000", "N G1", "T", "G1 X\"1\""})
+        REQUIRE(tokenize(line).index().letter == 0);
+      REQUIRE(tokenize("M117 Hello").is_command('M', 117));
+    }
+  }
+
+  GIVEN("A line edited with backspaces")
+  {
+    THEN("It is tokenized again at the end")
+    {
+      GCodeTokenizer tokenizer{};
+      for(const char c: std::string("N1 G1 X5")) tokenizer.feed(c);
+      tokenizer.invalidate();
+      const char line[] = "N1 G1 Y";
+      tokenizer.end(line, strlen(line));
+      REQUIRE(tokenizer.index().codebits == (uint32_t(1) << ('Y' - 'A')));
+    }
+  }
+
+  GIVEN("An index packed for the command queue")
+  {
+    const GCodeIndex index = tokenize("N9 G1 X10 Y20 E0.5*12").index();
+    char packed[64];
+
+    THEN("It only takes the fields used and the offsets of the parameters present")
+    {
+      // Offsets of the command letter and of '*', then X, Y and E
+      REQUIRE(index.pack(packed, sizeof(packed)) == GCodeIndex::PACKED_HEADER_SIZE + 2 + 3);
+      REQUIRE(GCodeIndex::packed_size(packed) == GCodeIndex::PACKED_HEADER_SIZE + 2 + 3);
+      GCodeIndex unpacked{};
+      unpacked.unpack(packed);
+      REQUIRE(unpacked.letter == 'G');
+      REQUIRE(unpacked.command == index.command);
+      REQUIRE(unpacked.star == index.star);
+      REQUIRE(unpacked.codenum == 1);
+      REQUIRE(unpacked.codebits == index.codebits);
+      for(const char c: {'X', 'Y', 'E'}) REQUIRE(unpacked.param[c - 'A'] == index.param[c - 'A']);
+    }
+
+    THEN("It is not indexed when there is not enough room")
+    {
+      REQUIRE(index.pack(packed, GCodeIndex::PACKED_HEADER_SIZE + 4) == 1);
+      REQUIRE(GCodeIndex::packed_size(packed) == 1);
+      GCodeIndex unpacked{};
+      unpacked.unpack(packed);
+      REQUIRE(unpacked.letter == 0);
+    }
+
+    THEN("A line read from a file takes 9 bytes")
+    {
+      const GCodeIndex sd = tokenize("G1 X112.345 Y98.765 E0.04213").index();
+      REQUIRE(sd.pack(packed, sizeof(packed)) == 9);
+    }
+
+    THEN("Large codenums and subcodes are kept")
+    {
+      const GCodeIndex other = tokenize("M7219 S1").index();
+      GCodeIndex sub = tokenize("G29 P1").index();
+      sub.subcode = 2; // As G29.2 with USE_GCODE_SUBCODES
+      GCodeIndex unpacked{};
+      REQUIRE(other.pack(packed, sizeof(packed)) == GCodeIndex::PACKED_HEADER_SIZE + 1 + 1);
+      unpacked.unpack(packed);
+      REQUIRE(unpacked.letter == 'M');
+      REQUIRE(unpacked.codenum == 7219);
+      REQUIRE(unpacked.param['S' - 'A'] == other.param['S' - 'A']);
+      sub.pack(packed, sizeof(packed));
+      unpacked.unpack(packed);
+      REQUIRE(unpacked.codenum == 29);
+      REQUIRE(unpacked.subcode == 2);
+      REQUIRE(GCodeIndex::packed_size(packed) == GCodeIndex::PACKED_HEADER_SIZE + 1 + 1);
+    }
+  }
+
+  GIVEN("Random lines")
+  {
+    THEN("The index gives the same parameters as GCodeParser")
+    {
+      std::mt19937 gen(42);
+      const char alphabet[] = "  GGMMTNXYZEFSPR0123456789..--+*!a";
+      std::uniform_int_distribution<int> length(1, 40), pick(0, sizeof(alphabet) - 2);
+      for(int i = 0; i < 200000; ++i) {
+        std::string line(i & 1 ? "G1 " : "");
+        for(int n = length(gen); n > 0; --n) line += alphabet[pick(gen)];
+        check(line);
+      }
+    }
+  }
+}
+
+TEST_CASE("Single-pass G-code tokenizer benchmark", "[Tokenizer][!benchmark]")
+{
+  const std::string line = with_checksum("N12345 G1 X123.456 Y98.765 E0.12345 F1800");
+
+  // Work done while characters are received
+  BENCHMARK("Tokenizer, all characters") {
+    return tokenize(line.c_str()).index().codebits;
+  };
+
+  // Work left when the end of line is received
+  GCodeTokenizer received{};
+  for(const char c: line) received.feed(c);
+
+  BENCHMARK("Tokenizer, end of line") {
+    GCodeTokenizer tokenizer = received;
+    tokenizer.end(line.c_str(), line.size());
+    GCodeIndex index = tokenizer.index();
+    return index.codebits + tokenizer.checksum_ok() + tokenizer.N();
+  };
+
+  BENCHMARK("Scans, end of line") {
+    char copy[128];
+    strcpy(copy, line.c_str());
+    const char *apos = strrchr(copy, '*');
+    uint8_t sum = 0, count = uint8_t(apos - copy);
+    while(count) sum ^= copy[--count];
+    const long n = strtol(copy + 1, nullptr, 10);
+    const Reference ref(copy);
+    return ref.codebits + sum + n;
+  };
+}